@@ -0,0 +1,144 @@
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+
+AssetLoader& AssetLoader::getInstance() {
+    static AssetLoader instance;
+    return instance;
+}
+
+void AssetLoader::start(int numThreads) {
+    if (running()) return;
+
+    if (numThreads <= 0) {
+        // leave a core for the main thread
+        numThreads = std::clamp(SDL_GetNumLogicalCPUCores() - 1, 1, 4);
+    }
+
+    quit_ = false;
+    for (int i = 0; i < numThreads; ++i) {
+        workers_.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+void AssetLoader::stop() {
+    if (!running()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        quit_ = true;
+        jobs_.clear();
+    }
+    wake_.notify_all();
+    for (auto& t : workers_) t.join();
+    workers_.clear();
+
+    for (auto& d : decoded_) {
+        if (d.surface) SDL_DestroySurface(d.surface);
+    }
+    decoded_.clear();
+
+    for (auto& kv : inFlight_) kv.second->failed = true;
+    inFlight_.clear();
+}
+
+std::shared_ptr<PendingTexture> AssetLoader::requestTexture(SDL_Renderer* renderer, const std::string& path) {
+    auto it = inFlight_.find(path);
+    if (it != inFlight_.end() && it->second->renderer == renderer) {
+        return it->second;
+    }
+
+    auto request = std::make_shared<PendingTexture>();
+    request->renderer = renderer;
+    request->path = path;
+
+    if (TextureHandle live = TextureCache::getInstance().find(renderer, path)) {
+        request->texture = live;
+        request->ready = true;
+        return request;
+    }
+
+    // Packed images have nothing to decode, uploading them right away is cheaper than a round trip
+    if (AssetPack::getInstance().contains(path)) {
+        request->texture = TextureCache::getInstance().acquire(renderer, path);
+        request->ready = (request->texture != nullptr);
+        request->failed = !request->ready;
+        return request;
+    }
+
+    inFlight_[path] = request;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(request);
+    }
+    wake_.notify_one();
+    return request;
+}
+
+int AssetLoader::pump(double budgetMs) {
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const double perfFreq = static_cast<double>(SDL_GetPerformanceFrequency());
+    int uploaded = 0;
+
+    while (true) {
+        Decoded d;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (decoded_.empty()) break;
+            d = decoded_.front();
+            decoded_.pop_front();
+        }
+
+        PendingTexture& req = *d.request;
+        inFlight_.erase(req.path);
+
+        if (d.surface) {
+            // Someone may have loaded it synchronously meanwhile
+            req.texture = TextureCache::getInstance().find(req.renderer, req.path);
+            if (!req.texture) {
+                SDL_Texture* t = SDL_CreateTextureFromSurface(req.renderer, d.surface);
+                if (t) {
+                    req.texture = TextureCache::getInstance().adopt(req.renderer, req.path, t);
+                    ++uploaded;
+                }
+                else {
+                    SDL_Log("AssetLoader: failed to upload '%s': %s", req.path.c_str(), SDL_GetError());
+                }
+            }
+            SDL_DestroySurface(d.surface);
+        }
+        req.ready = (req.texture != nullptr);
+        req.failed = !req.ready;
+
+        const double ms = (SDL_GetPerformanceCounter() - start) * 1000.0 / perfFreq;
+        if (ms >= budgetMs) break;
+    }
+    return uploaded;
+}
+
+void AssetLoader::workerLoop() {
+    while (true) {
+        std::shared_ptr<PendingTexture> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this] { return quit_ || !jobs_.empty(); });
+            if (quit_) return;
+            job = jobs_.front();
+            jobs_.pop_front();
+        }
+
+        // job->path is never written after the request is queued, so reading it here is safe
+        SDL_Surface* surface = IMG_Load(job->path.c_str());
+        if (!surface) {
+            SDL_Log("AssetLoader: failed to load '%s': %s", job->path.c_str(), SDL_GetError());
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (quit_) {
+            if (surface) SDL_DestroySurface(surface);
+            return;
+        }
+        decoded_.push_back(Decoded{ job, surface });
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <SDL3/SDL.h>
+
+#include "TextureCache.h"
+
+// A texture request handed out by AssetLoader.
+// Only touched on the main thread: pump() fills it in once the upload is done.
+struct PendingTexture {
+    SDL_Renderer* renderer = nullptr;
+    std::string   path;
+    TextureHandle texture;      // valid once ready
+    bool          ready = false;
+    bool          failed = false;
+
+    bool done() const { return ready || failed; }
+};
+
+// Background image loader.
+// PNG decode (IMG_Load -> SDL_Surface) runs on worker threads; the texture upload has to
+// happen on the render thread, so pump() drains finished surfaces under a per-frame time budget.
+// Uploaded textures are handed to the TextureCache, so later acquire() calls share them.
+class AssetLoader {
+public:
+    static AssetLoader& getInstance();
+
+    // Spin up the worker threads (0 = pick from the CPU count)
+    void start(int numThreads = 0);
+
+    // Join the workers and drop everything queued or decoded but not uploaded yet.
+    // Must run before the renderer is destroyed.
+    void stop();
+
+    bool running() const { return !workers_.empty(); }
+
+    // Queue path for loading. Requests for a path already in flight share one PendingTexture.
+    // If the texture is already alive in the cache the returned request is ready immediately.
+    std::shared_ptr<PendingTexture> requestTexture(SDL_Renderer* renderer, const std::string& path);
+
+    // Upload decoded surfaces until budgetMs is spent (at least one per call so loading
+    // always makes progress). Call once per frame on the render thread.
+    // Returns the number of textures uploaded.
+    int pump(double budgetMs);
+
+    // Requests not finished yet (queued, decoding or waiting for upload)
+    size_t pendingCount() const { return inFlight_.size(); }
+
+private:
+    AssetLoader() = default;
+    ~AssetLoader() { stop(); }
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    struct Decoded {
+        std::shared_ptr<PendingTexture> request;
+        SDL_Surface* surface = nullptr; // nullptr = decode failed
+    };
+
+    void workerLoop();
+
+    std::vector<std::thread> workers_;
+
+    // guarded by mutex_
+    std::mutex                                  mutex_;
+    std::condition_variable                     wake_;
+    std::deque<std::shared_ptr<PendingTexture>> jobs_;
+    std::deque<Decoded>                         decoded_;
+    bool                                        quit_ = false;
+
+    // main thread only: path -> request, so repeat requests don't decode twice
+    std::unordered_map<std::string, std::shared_ptr<PendingTexture>> inFlight_;
+};
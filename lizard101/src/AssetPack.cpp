@@ -0,0 +1,227 @@
+#include "AssetPack.h"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const uint64_t kBlobAlign = 16;
+
+    uint64_t alignUp(uint64_t v) { return (v + kBlobAlign - 1) & ~(kBlobAlign - 1); }
+
+    bool isImage(const std::filesystem::path& p) {
+        std::string ext = p.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp";
+    }
+}
+
+AssetPack& AssetPack::getInstance() {
+    static AssetPack instance;
+    return instance;
+}
+
+bool AssetPack::open(const std::string& packPath) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(packPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER fileSize{};
+    GetFileSizeEx(file, &fileSize);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        SDL_Log("AssetPack: failed to map '%s'", packPath.c_str());
+        return false;
+    }
+    fileHandle_ = file;
+    mapHandle_ = mapping;
+    size_ = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(packPath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st {};
+    fstat(fd, &st);
+    void* view = (st.st_size > 0) ? mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    ::close(fd); // the mapping stays valid
+    if (view == MAP_FAILED) {
+        SDL_Log("AssetPack: failed to map '%s'", packPath.c_str());
+        return false;
+    }
+    size_ = static_cast<size_t>(st.st_size);
+#endif
+    data_ = static_cast<const uint8_t*>(view);
+
+    // --- Validate and index ---
+    const PackHeader* header = reinterpret_cast<const PackHeader*>(data_);
+    if (size_ < sizeof(PackHeader) || std::memcmp(header->magic, kMagic, sizeof(kMagic)) != 0 ||
+        header->version != kVersion ||
+        size_ < sizeof(PackHeader) + static_cast<uint64_t>(header->count) * sizeof(PackEntry)) {
+        SDL_Log("AssetPack: '%s' is not a valid pack", packPath.c_str());
+        close();
+        return false;
+    }
+
+    const PackEntry* entries = reinterpret_cast<const PackEntry*>(data_ + sizeof(PackHeader));
+    for (uint32_t i = 0; i < header->count; ++i) {
+        const PackEntry& e = entries[i];
+        const uint64_t bytes = static_cast<uint64_t>(e.width) * e.height * 4;
+        if (static_cast<uint64_t>(e.pathOffset) + e.pathLength > size_ || e.pixelOffset + bytes > size_) {
+            SDL_Log("AssetPack: '%s' entry %u is out of range", packPath.c_str(), i);
+            close();
+            return false;
+        }
+        index_.emplace(std::string(reinterpret_cast<const char*>(data_ + e.pathOffset), e.pathLength), &e);
+    }
+
+    SDL_Log("AssetPack: mapped %zu images from '%s'", index_.size(), packPath.c_str());
+    return true;
+}
+
+void AssetPack::close() {
+    index_.clear();
+    if (!data_) return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(static_cast<HANDLE>(mapHandle_));
+    CloseHandle(static_cast<HANDLE>(fileHandle_));
+#else
+    munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    fileHandle_ = mapHandle_ = nullptr;
+}
+
+float AssetPack::scaleOf(const std::string& path) const {
+    auto it = index_.find(path);
+    if (it == index_.end() || it->second->originalWidth == 0) return 1.0f;
+    return static_cast<float>(it->second->width) / static_cast<float>(it->second->originalWidth);
+}
+
+SDL_Surface* AssetPack::loadSurface(const std::string& path) const {
+    auto it = index_.find(path);
+    if (it == index_.end()) {
+        return IMG_Load(path.c_str());
+    }
+
+    // Read-only mapping: nothing writes to these pixels, SDL only blits/uploads from them
+    const PackEntry& e = *it->second;
+    return SDL_CreateSurfaceFrom(static_cast<int>(e.width), static_cast<int>(e.height), SDL_PIXELFORMAT_RGBA32,
+        const_cast<uint8_t*>(data_ + e.pixelOffset), static_cast<int>(e.width * 4));
+}
+
+int AssetPack::build(const std::string& mediaDir, const std::string& keyPrefix,
+    const std::string& outPath, int maxSize) {
+    namespace fs = std::filesystem;
+
+    struct Item {
+        std::string  key;
+        SDL_Surface* surface;
+        uint32_t     originalW, originalH;
+    };
+    std::vector<Item> items;
+
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(mediaDir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file() || !isImage(it->path())) continue;
+
+        const std::string file = it->path().string();
+        SDL_Surface* loaded = IMG_Load(file.c_str());
+        if (!loaded) {
+            SDL_Log("AssetPack: failed to load '%s': %s", file.c_str(), SDL_GetError());
+            continue;
+        }
+        SDL_Surface* s = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+        const uint32_t ow = loaded->w, oh = loaded->h;
+        SDL_DestroySurface(loaded);
+        if (!s) continue;
+
+        if (maxSize > 0 && (s->w > maxSize || s->h > maxSize)) {
+            const float k = std::min(maxSize / static_cast<float>(s->w), maxSize / static_cast<float>(s->h));
+            const int w = std::max(1, static_cast<int>(s->w * k));
+            const int h = std::max(1, static_cast<int>(s->h * k));
+            if (SDL_Surface* scaled = SDL_ScaleSurface(s, w, h, SDL_SCALEMODE_LINEAR)) {
+                SDL_DestroySurface(s);
+                s = scaled;
+            }
+        }
+
+        const std::string key = keyPrefix + "/" + fs::relative(it->path(), mediaDir).generic_string();
+        items.push_back(Item{ key, s, ow, oh });
+    }
+    if (ec) {
+        SDL_Log("AssetPack: cannot read '%s': %s", mediaDir.c_str(), ec.message().c_str());
+    }
+
+    // Stable order keeps rebuilt packs byte-identical
+    std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.key < b.key; });
+
+    // --- Lay out the file ---
+    PackHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.count = static_cast<uint32_t>(items.size());
+
+    std::vector<PackEntry> entries(items.size());
+    uint64_t offset = sizeof(PackHeader) + entries.size() * sizeof(PackEntry);
+    for (size_t i = 0; i < items.size(); ++i) {
+        entries[i].pathOffset = static_cast<uint32_t>(offset);
+        entries[i].pathLength = static_cast<uint32_t>(items[i].key.size());
+        offset += items[i].key.size();
+    }
+    for (size_t i = 0; i < items.size(); ++i) {
+        offset = alignUp(offset);
+        entries[i].pixelOffset = offset;
+        entries[i].width = items[i].surface->w;
+        entries[i].height = items[i].surface->h;
+        entries[i].originalWidth = items[i].originalW;
+        entries[i].originalHeight = items[i].originalH;
+        offset += static_cast<uint64_t>(entries[i].width) * entries[i].height * 4;
+    }
+
+    // --- Write ---
+    std::ofstream out(outPath, std::ios::binary);
+    bool ok = static_cast<bool>(out);
+    if (ok) {
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(PackEntry));
+        for (const auto& item : items) out.write(item.key.data(), item.key.size());
+
+        const char zeros[kBlobAlign] = {};
+        for (size_t i = 0; i < items.size(); ++i) {
+            const uint64_t at = static_cast<uint64_t>(out.tellp());
+            out.write(zeros, entries[i].pixelOffset - at);
+
+            // rows may be padded in the surface, the pack stores them tight
+            const SDL_Surface* s = items[i].surface;
+            for (int y = 0; y < s->h; ++y) {
+                out.write(static_cast<const char*>(s->pixels) + static_cast<size_t>(y) * s->pitch, s->w * 4);
+            }
+        }
+        ok = static_cast<bool>(out);
+    }
+    if (!ok) SDL_Log("AssetPack: failed to write '%s'", outPath.c_str());
+
+    for (auto& item : items) SDL_DestroySurface(item.surface);
+    return ok ? static_cast<int>(items.size()) : -1;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <SDL3/SDL.h>
+
+// Pre-decoded image pack.
+// packassets converts the media/ tree into one file of raw RGBA32 pixel blobs plus a path
+// index. At runtime the file is memory-mapped and images are handed out as surfaces that
+// point straight into the mapping, so loading one costs an upload instead of a PNG decode.
+// Keys are the same relative paths the game already uses (e.g. "media/cards/fireball.png").
+//
+// File layout (little endian):
+//   PackHeader
+//   PackEntry[count]
+//   path strings (not null terminated)
+//   pixel blobs, each 16-byte aligned, tightly packed rows (pitch = w * 4)
+class AssetPack {
+public:
+    static constexpr char     kMagic[8] = { 'L','1','0','1','P','A','C','K' };
+    static constexpr uint32_t kVersion = 1;
+
+    struct PackHeader {
+        char     magic[8];
+        uint32_t version;
+        uint32_t count;
+    };
+
+    struct PackEntry {
+        uint64_t pixelOffset;  // from start of file
+        uint32_t pathOffset;   // from start of file
+        uint32_t pathLength;
+        uint32_t width;        // stored pixels
+        uint32_t height;
+        uint32_t originalWidth;  // before pre-scaling
+        uint32_t originalHeight;
+    };
+
+    static AssetPack& getInstance();
+
+    // Map a pack file. Returns false (and stays empty) if it is missing or malformed.
+    // Open before starting the AssetLoader: lookups are read-only afterwards and thread safe.
+    bool open(const std::string& packPath);
+    void close();
+    bool isOpen() const { return data_ != nullptr; }
+
+    bool contains(const std::string& path) const { return index_.count(path) != 0; }
+
+    // Stored size / original size for path (1 if not packed or not pre-scaled)
+    float scaleOf(const std::string& path) const;
+
+    // Surface for path. Packed images wrap the mapped pixels (no copy, no decode); anything
+    // else falls back to IMG_Load. Caller destroys the surface. nullptr on failure.
+    SDL_Surface* loadSurface(const std::string& path) const;
+
+    // Decode every image under mediaDir and write a pack to outPath.
+    // Keys are keyPrefix + "/" + the path relative to mediaDir.
+    // Images larger than maxSize in either dimension are downscaled (0 = never).
+    // Returns the number of images written, or -1 on error.
+    static int build(const std::string& mediaDir, const std::string& keyPrefix,
+        const std::string& outPath, int maxSize = 0);
+
+private:
+    AssetPack() = default;
+    ~AssetPack() { close(); }
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    const uint8_t* data_ = nullptr;
+    size_t         size_ = 0;
+    void*          fileHandle_ = nullptr;  // platform mapping handles
+    void*          mapHandle_ = nullptr;
+
+    std::unordered_map<std::string, const PackEntry*> index_;
+};
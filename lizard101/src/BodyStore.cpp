@@ -0,0 +1,162 @@
+#include "BodyStore.h"
+#include <algorithm>
+#include <cmath>
+
+BodyStore& BodyStore::getInstance() {
+    static BodyStore instance;
+    return instance;
+}
+
+uint32_t BodyStore::allocate(float px, float py, int w, int h, bool physicsEnabled) {
+    uint32_t body;
+    if (!free_.empty()) {
+        body = free_.back();
+        free_.pop_back();
+    }
+    else {
+        body = static_cast<uint32_t>(x.size());
+        x.push_back(0.0f);
+        y.push_back(0.0f);
+        width.push_back(0);
+        height.push_back(0);
+        velY.push_back(0.0f);
+        physics.push_back(0);
+        managed.push_back(0);
+        range_.emplace_back();
+        cellPos_.emplace_back();
+        seen_.push_back(0);
+        dirty_.push_back(0);
+        dirtyRows_.push_back(0);
+    }
+
+    x[body] = px;
+    y[body] = py;
+    width[body] = w;
+    height[body] = h;
+    velY[body] = 0.0f;
+    physics[body] = physicsEnabled ? 1 : 0;
+    managed[body] = 0;
+    return body;
+}
+
+void BodyStore::release(uint32_t body) {
+    if (body >= x.size()) return;
+    setManaged(body, false);
+    physics[body] = 0;
+    free_.push_back(body);
+}
+
+void BodyStore::setManaged(uint32_t body, bool on) {
+    if ((managed[body] != 0) == on) return;
+    managed[body] = on ? 1 : 0;
+    if (on) {
+        range_[body] = rangeOf(body);
+        insertCells(body);
+    }
+    else {
+        removeCells(body);
+    }
+}
+
+// ----------------- Grid -----------------
+
+int32_t BodyStore::cellOf(float v) {
+    // Clamped so far-off (or garbage) coordinates can't overflow the cell index
+    const float c = std::floor(v / kCellSize);
+    if (!(c > -1e9f)) return -1000000000;
+    if (c > 1e9f) return 1000000000;
+    return static_cast<int32_t>(c);
+}
+
+BodyStore::CellRange BodyStore::rangeOf(uint32_t body) const {
+    const float w = static_cast<float>(std::max(width[body], 0));
+    const float h = static_cast<float>(std::max(height[body], 0));
+    return CellRange{ cellOf(x[body]), cellOf(y[body]), cellOf(x[body] + w), cellOf(y[body] + h) };
+}
+
+void BodyStore::insertCells(uint32_t body) {
+    const CellRange& r = range_[body];
+    std::vector<uint32_t>& pos = cellPos_[body];
+    pos.clear();
+    auto add = [body, &pos](std::vector<CellEntry>& list) {
+        const uint32_t k = static_cast<uint32_t>(pos.size());
+        pos.push_back(static_cast<uint32_t>(list.size()));
+        list.push_back(CellEntry{ body, k });
+    };
+    if (r.count() > kMaxCells) {
+        add(oversized_);
+        return;
+    }
+    for (int32_t cy = r.y0; cy <= r.y1; ++cy) {
+        for (int32_t cx = r.x0; cx <= r.x1; ++cx) add(cells_[cellKey(cx, cy)]);
+    }
+}
+
+void BodyStore::removeCells(uint32_t body) {
+    // Swap-remove from each list the row is in, fixing up the entry that moved into its place
+    const std::vector<uint32_t>& pos = cellPos_[body];
+    auto drop = [this, &pos](std::vector<CellEntry>& list, uint32_t k) {
+        const uint32_t at = pos[k];
+        const CellEntry moved = list.back();
+        list[at] = moved;
+        cellPos_[moved.body][moved.k] = at;
+        list.pop_back();
+    };
+    const CellRange& r = range_[body];
+    if (r.count() > kMaxCells) {
+        drop(oversized_, 0);
+        return;
+    }
+    uint32_t k = 0;
+    for (int32_t cy = r.y0; cy <= r.y1; ++cy) {
+        for (int32_t cx = r.x0; cx <= r.x1; ++cx) drop(cells_.find(cellKey(cx, cy))->second, k++);
+    }
+}
+
+void BodyStore::syncGrid() {
+    const uint32_t n = dirtyCount_.exchange(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < n; ++i) {
+        const uint32_t body = dirtyRows_[i];
+        dirty_[body] = 0;
+        if (!managed[body]) continue; // binned on setManaged instead
+        const CellRange r = rangeOf(body);
+        if (r == range_[body]) continue; // moved inside its cells
+        removeCells(body);
+        range_[body] = r;
+        insertCells(body);
+    }
+}
+
+void BodyStore::query(float qx, float qy, float qw, float qh, std::vector<uint32_t>& out) {
+    if (++queryStamp_ == 0) { // wrapped: forget every old stamp
+        std::fill(seen_.begin(), seen_.end(), 0);
+        queryStamp_ = 1;
+    }
+    auto take = [this, &out](uint32_t body) {
+        if (seen_[body] == queryStamp_) return;
+        seen_[body] = queryStamp_;
+        out.push_back(body);
+    };
+
+    const int32_t x0 = cellOf(qx), y0 = cellOf(qy);
+    const int32_t x1 = cellOf(qx + std::max(qw, 0.0f)), y1 = cellOf(qy + std::max(qh, 0.0f));
+    if ((int64_t(x1) - x0 + 1) * (int64_t(y1) - y0 + 1) > int64_t(cells_.size())) {
+        // Rect covers more cells than exist: walk the cells instead of the rect
+        for (const auto& cell : cells_) {
+            const int32_t cx = static_cast<int32_t>(cell.first >> 32);
+            const int32_t cy = static_cast<int32_t>(static_cast<uint32_t>(cell.first));
+            if (cx < x0 || cx > x1 || cy < y0 || cy > y1) continue;
+            for (const CellEntry& c : cell.second) take(c.body);
+        }
+    }
+    else {
+        for (int32_t cy = y0; cy <= y1; ++cy) {
+            for (int32_t cx = x0; cx <= x1; ++cx) {
+                auto it = cells_.find(cellKey(cx, cy));
+                if (it == cells_.end()) continue;
+                for (const CellEntry& c : it->second) take(c.body);
+            }
+        }
+    }
+    for (const CellEntry& c : oversized_) take(c.body);
+}
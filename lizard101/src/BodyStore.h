@@ -0,0 +1,115 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Structure-of-arrays storage for entity transforms and physics bodies.
+// Every Entity owns one row (its body id) for its whole lifetime; Entity's position, size
+// and velocity accessors read and write these columns. Systems that touch a few floats
+// per entity (physics, culling, collision) can stream the columns instead of chasing
+// Entity pointers.
+//
+// Rows of destroyed entities are recycled. A row is only "live" for systems while its
+// entity is in the EntityManager (managed), so half-built entities are left alone.
+//
+// Managed rows are also binned in a uniform grid of their rects, so "what overlaps this
+// rect" (render culling) costs what is in the rect, not what is in the level. Code that
+// writes x/y/width/height goes through the setters or calls moved(); the grid is re-binned
+// from the moved rows in syncGrid().
+//
+// Not thread safe. Constructing an Entity allocates a row, which can reallocate every
+// column, so creating entities, reading or writing positions, and running the update passes
+// must all happen on one thread or under one lock (the server uses entityMutex). The one
+// exception is the parallel update: workers may write (and mark moved) different rows.
+class BodyStore {
+public:
+    static BodyStore& getInstance();
+
+    uint32_t allocate(float x, float y, int w, int h, bool physicsEnabled);
+    void     release(uint32_t body);
+
+    // Number of rows (live or free); iterate [0, size()) and check managed/physics
+    size_t size() const { return x.size(); }
+
+    // EntityManager sets this on add/remove; managed rows are in the grid
+    void setManaged(uint32_t body, bool on);
+
+    void setX(uint32_t body, float v) { x[body] = v; moved(body); }
+    void setY(uint32_t body, float v) { y[body] = v; moved(body); }
+    void setWidth(uint32_t body, int w) { width[body] = w; moved(body); }
+    void setHeight(uint32_t body, int h) { height[body] = h; moved(body); }
+
+    // Queues the row for re-binning; call after writing its rect columns directly
+    void moved(uint32_t body) {
+        if (dirty_[body]) return;
+        dirty_[body] = 1;
+        dirtyRows_[dirtyCount_.fetch_add(1, std::memory_order_relaxed)] = body;
+    }
+
+    // Re-bins every row moved since the last call
+    void syncGrid();
+
+    // Appends each managed row whose grid cells overlap the rect (once each; may include rows
+    // that only share a cell with it, so callers still test the exact bounds). Call syncGrid first.
+    void query(float qx, float qy, float qw, float qh, std::vector<uint32_t>& out);
+
+    // Columns, indexed by body id
+    std::vector<float>   x;
+    std::vector<float>   y;
+    std::vector<int>     width;
+    std::vector<int>     height;
+    std::vector<float>   velY;
+    std::vector<uint8_t> physics;  // physicsEnabled
+    std::vector<uint8_t> managed;  // owning entity is in the EntityManager
+
+private:
+    BodyStore() = default;
+    BodyStore(const BodyStore&) = delete;
+    BodyStore& operator=(const BodyStore&) = delete;
+
+    // Grid cells are kCellSize world units square. A row spanning more than kMaxCells cells
+    // (backgrounds, long floors) sits in oversized_ instead and every query returns it.
+    static constexpr float kCellSize = 256.0f;
+    static constexpr int   kMaxCells = 64;
+
+    struct CellRange {
+        int32_t x0 = 0, y0 = 0, x1 = -1, y1 = -1; // inclusive; empty by default
+
+        bool operator==(const CellRange& o) const { return x0 == o.x0 && y0 == o.y0 && x1 == o.x1 && y1 == o.y1; }
+        bool operator!=(const CellRange& o) const { return !(*this == o); }
+        int64_t count() const { return (int64_t(x1) - x0 + 1) * (int64_t(y1) - y0 + 1); }
+    };
+
+    static int32_t cellOf(float v);
+    static uint64_t cellKey(int32_t cx, int32_t cy) {
+        return (uint64_t(uint32_t(cx)) << 32) | uint32_t(cy);
+    }
+    CellRange rangeOf(uint32_t body) const;
+    void insertCells(uint32_t body);
+    void removeCells(uint32_t body);
+
+    std::vector<uint32_t> free_;
+
+    // Grid. Emptied cells are kept, so a level that has been walked once stops allocating.
+    // Each entry remembers which of its row's cells it is (k, row-major in the range), and
+    // cellPos_[row][k] is where that entry sits, so leaving a cell is a swap-remove.
+    struct CellEntry {
+        uint32_t body;
+        uint32_t k;
+    };
+    std::unordered_map<uint64_t, std::vector<CellEntry>> cells_;
+    std::vector<CellEntry> oversized_;  // k is always 0
+    std::vector<CellRange> range_;      // cells each managed row is binned under
+    std::vector<std::vector<uint32_t>> cellPos_; // per row; keeps its capacity when the row is reused
+    std::vector<uint32_t>  seen_;       // per row: last query that returned it
+    uint32_t               queryStamp_ = 0;
+
+    // Moved rows waiting for syncGrid. A row is listed at most once (dirty_), so
+    // dirtyRows_ never needs more than one entry per row.
+    std::vector<uint8_t>  dirty_;
+    std::vector<uint32_t> dirtyRows_;
+    std::atomic<uint32_t> dirtyCount_{ 0 };
+};
@@ -0,0 +1,88 @@
+#include "EntityCommandBuffer.h"
+
+EntityCommandBuffer::~EntityCommandBuffer() {
+    clear();
+}
+
+void EntityCommandBuffer::defaultDelete(void* /*ctx*/, Entity* e) {
+    delete e;
+}
+
+Entity* EntityCommandBuffer::push(Op op, Entity* entity, EntityDeleter deleter) {
+    if (!entity) return nullptr;
+    Command cmd;
+    cmd.op = op;
+    cmd.entity = entity;
+    cmd.deleter = deleter;
+    commands_.push_back(std::move(cmd));
+    creates_++;
+    return entity;
+}
+
+Entity* EntityCommandBuffer::create(Entity* entity, EntityDeleter deleter) {
+    return push(Op::Create, entity, deleter);
+}
+
+Entity* EntityCommandBuffer::createInFront(Entity* entity, EntityDeleter deleter) {
+    return push(Op::CreateInFront, entity, deleter);
+}
+
+bool EntityCommandBuffer::isPending(const Entity* entity) const {
+    for (const auto& cmd : commands_) {
+        if ((cmd.op == Op::Create || cmd.op == Op::CreateInFront) && cmd.entity == entity) return true;
+    }
+    return false;
+}
+
+void EntityCommandBuffer::destroy(Entity* entity) {
+    if (!entity) return;
+    if (!entity->handle.isNull()) {
+        destroy(entity->handle);
+        return;
+    }
+    if (!isPending(entity)) return; // not managed and not ours: nothing to do
+
+    // Cancel the create and anything recorded against the entity, then free it
+    EntityDeleter deleter{ nullptr, nullptr };
+    for (auto& cmd : commands_) {
+        if (cmd.entity != entity) continue;
+        if (cmd.op == Op::Create || cmd.op == Op::CreateInFront) {
+            deleter = cmd.deleter;
+            creates_--;
+        }
+        cmd.entity = nullptr;
+    }
+    if (deleter.fn) deleter.fn(deleter.ctx, entity);
+}
+
+void EntityCommandBuffer::destroy(EntityHandle handle) {
+    if (handle.isNull()) return;
+    Command cmd;
+    cmd.op = Op::Destroy;
+    cmd.handle = handle;
+    commands_.push_back(std::move(cmd));
+}
+
+void EntityCommandBuffer::record(Entity* entity, std::function<void(Entity&)> fn) {
+    const bool managed = !entity->handle.isNull();
+    if (!managed && !isPending(entity)) {
+        fn(*entity); // nobody iterates an unmanaged entity, so there is nothing to defer
+        return;
+    }
+    Command cmd;
+    cmd.op = Op::Apply;
+    cmd.fn = std::move(fn);
+    if (managed) cmd.handle = entity->handle;
+    else cmd.entity = entity;
+    commands_.push_back(std::move(cmd));
+}
+
+void EntityCommandBuffer::clear() {
+    for (auto& cmd : commands_) {
+        if ((cmd.op == Op::Create || cmd.op == Op::CreateInFront) && cmd.entity && cmd.deleter.fn) {
+            cmd.deleter.fn(cmd.deleter.ctx, cmd.entity);
+        }
+    }
+    commands_.clear();
+    creates_ = 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "Entity.h"
+
+// Records structural changes (create, destroy, add component) instead of making them
+// right away, so code running inside updateAll or an event listener can change the entity
+// set without invalidating anyone's iteration. EntityManager::playback applies a buffer in
+// one batch, in the order the commands were recorded.
+//
+// The manager owns one buffer per frame (EntityManager::commands()); it is played back
+// when updateAll starts and ends and before renderAll draws.
+class EntityCommandBuffer {
+public:
+    EntityCommandBuffer() = default;
+    ~EntityCommandBuffer();
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    // Takes ownership; the entity is added to the manager at playback. Until then it can be
+    // set up (components, tag, render layer) directly through the returned pointer.
+    Entity* create(Entity* entity, EntityDeleter deleter = EntityDeleter{ &defaultDelete, nullptr });
+    Entity* createInFront(Entity* entity, EntityDeleter deleter = EntityDeleter{ &defaultDelete, nullptr });
+
+    // Removes a managed entity at playback. On an entity still waiting in create(),
+    // the create is cancelled and the entity freed right away.
+    void destroy(Entity* entity);
+    void destroy(EntityHandle handle);
+
+    // Adds a component at playback (arguments are copied). Skipped if the entity is gone by then.
+    // On an entity that is neither managed nor pending the component is added right away.
+    template <typename T, typename... Args>
+    void addComponent(Entity* entity, Args&&... args) {
+        if (!entity) return;
+        auto stored = std::make_tuple(std::decay_t<Args>(std::forward<Args>(args))...);
+        record(entity, [stored](Entity& e) mutable {
+            std::apply([&e](auto&... a) { e.addComponent<T>(std::move(a)...); }, stored);
+        });
+    }
+
+    bool   empty() const { return commands_.empty(); }
+    size_t size() const { return commands_.size(); }
+
+    // Drops every command, freeing entities that were waiting to be created
+    void clear();
+
+private:
+    friend class EntityManager;
+
+    enum class Op : uint8_t { Create, CreateInFront, Destroy, Apply };
+
+    struct Command {
+        Op            op;
+        Entity*       entity = nullptr;   // Create/Apply on a pending entity (null once cancelled)
+        EntityHandle  handle;             // Destroy/Apply on a managed entity
+        EntityDeleter deleter{ nullptr, nullptr };
+        std::function<void(Entity&)> fn;  // Apply
+    };
+
+    std::vector<Command> commands_;
+    size_t               creates_ = 0; // live Create commands, lets playback reserve once
+
+    static void defaultDelete(void* ctx, Entity* e);
+    Entity* push(Op op, Entity* entity, EntityDeleter deleter);
+    bool    isPending(const Entity* entity) const;
+    void    record(Entity* entity, std::function<void(Entity&)> fn);
+};
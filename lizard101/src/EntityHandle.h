@@ -0,0 +1,26 @@
+// EntityHandle.h
+#pragma once
+#include <cstdint>
+
+// Generational reference to an entity owned by EntityManager.
+// The slot index is reused after the entity is removed, but the generation is bumped,
+// so a handle to a removed entity resolves to nullptr instead of to whatever took its slot.
+struct EntityHandle {
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    bool isNull() const { return index == kInvalidIndex; }
+
+    bool operator==(const EntityHandle& o) const { return index == o.index && generation == o.generation; }
+    bool operator!=(const EntityHandle& o) const { return !(*this == o); }
+};
+
+struct Entity;
+
+// How EntityManager frees an entity it owns (fn may be null for entities owned elsewhere)
+struct EntityDeleter {
+    void (*fn)(void* ctx, Entity* e);
+    void* ctx;
+};
@@ -6,9 +6,23 @@ float  Input::s_mouseX = 0.0f;
 float  Input::s_mouseY = 0.0f;
 Uint32 Input::s_mouseButtons = 0;
 
+bool   Input::s_scripted = false;
+bool   Input::s_scriptedKeys[SDL_SCANCODE_COUNT] = {};
+float  Input::s_scriptedMouseX = 0.0f;
+float  Input::s_scriptedMouseY = 0.0f;
+Uint32 Input::s_scriptedMouseButtons = 0;
+
 void Input::update() {
     // SDL_PumpEvents(); to use SDL's built in updating [Not used]
 
+    if (s_scripted) {
+        keyboardState = s_scriptedKeys;
+        s_mouseX = s_scriptedMouseX;
+        s_mouseY = s_scriptedMouseY;
+        s_mouseButtons = s_scriptedMouseButtons;
+        return;
+    }
+
     keyboardState = SDL_GetKeyboardState(nullptr);
 
     // SDL3 returns a button bitmask and writes the cursor position
@@ -34,3 +48,20 @@ bool Input::isMouseButtonPressed(Uint32 sdlButtonMask) {
 bool Input::isChordPressed(SDL_Scancode a, SDL_Scancode b) {
     return isKeyPressed(a) && isKeyPressed(b);
 }
+
+void Input::setScripted(bool scripted) { s_scripted = scripted; }
+bool Input::isScripted() { return s_scripted; }
+
+void Input::setScriptedMouse(float x, float y) {
+    s_scriptedMouseX = x;
+    s_scriptedMouseY = y;
+}
+
+void Input::setScriptedMouseButton(Uint32 sdlButtonMask, bool down) {
+    if (down) s_scriptedMouseButtons |= sdlButtonMask;
+    else      s_scriptedMouseButtons &= ~sdlButtonMask;
+}
+
+void Input::setScriptedKey(SDL_Scancode key, bool down) {
+    if (key > SDL_SCANCODE_UNKNOWN && key < SDL_SCANCODE_COUNT) s_scriptedKeys[key] = down;
+}
@@ -14,6 +14,12 @@ public:
     static bool isMouseButtonPressed(Uint32 sdlButtonMask);
     static bool isChordPressed(SDL_Scancode a, SDL_Scancode b);
 
+    // Scripted mode (headless runs): update() stops reading SDL and the state below is used instead
+    static void setScripted(bool scripted);
+    static bool isScripted();
+    static void setScriptedMouse(float x, float y);
+    static void setScriptedMouseButton(Uint32 sdlButtonMask, bool down);
+    static void setScriptedKey(SDL_Scancode key, bool down);
 
 private:
     static const bool* keyboardState;
@@ -21,4 +27,10 @@ private:
     static float s_mouseX;
     static float s_mouseY;
     static Uint32 s_mouseButtons;
+
+    static bool s_scripted;
+    static bool s_scriptedKeys[SDL_SCANCODE_COUNT];
+    static float s_scriptedMouseX;
+    static float s_scriptedMouseY;
+    static Uint32 s_scriptedMouseButtons;
 };
@@ -0,0 +1,75 @@
+#include "InputScript.h"
+#include "Input.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+bool InputScript::load(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        SDL_Log("InputScript: cannot open '%s'", path.c_str());
+        return false;
+    }
+
+    commands_.clear();
+    next_ = 0;
+
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(in, line)) {
+        ++lineNo;
+        const size_t hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream ss(line);
+        Command c{ 0, Op::Mouse, 0.0f, 0.0f, 0, SDL_SCANCODE_UNKNOWN };
+        std::string op;
+        if (!(ss >> c.frame >> op)) continue; // blank line
+
+        bool ok = true;
+        if (op == "mouse") {
+            c.op = Op::Mouse;
+            ok = static_cast<bool>(ss >> c.x >> c.y);
+        }
+        else if (op == "press" || op == "release") {
+            std::string which;
+            ss >> which;
+            c.op = (op == "press") ? Op::Press : Op::Release;
+            c.button = (which == "right") ? SDL_BUTTON_RMASK : SDL_BUTTON_LMASK;
+        }
+        else if (op == "key") {
+            std::string name, state;
+            ss >> name >> state;
+            c.key = SDL_GetScancodeFromName(name.c_str());
+            c.op = (state == "up") ? Op::KeyUp : Op::KeyDown;
+            ok = (c.key != SDL_SCANCODE_UNKNOWN);
+        }
+        else {
+            ok = false;
+        }
+
+        if (!ok) {
+            SDL_Log("InputScript: %s:%d: cannot parse '%s'", path.c_str(), lineNo, line.c_str());
+            continue;
+        }
+        commands_.push_back(c);
+    }
+
+    std::stable_sort(commands_.begin(), commands_.end(),
+        [](const Command& a, const Command& b) { return a.frame < b.frame; });
+    return true;
+}
+
+void InputScript::apply(int frame) {
+    while (next_ < commands_.size() && commands_[next_].frame <= frame) {
+        const Command& c = commands_[next_++];
+        switch (c.op) {
+        case Op::Mouse:   Input::setScriptedMouse(c.x, c.y); break;
+        case Op::Press:   Input::setScriptedMouseButton(c.button, true); break;
+        case Op::Release: Input::setScriptedMouseButton(c.button, false); break;
+        case Op::KeyDown: Input::setScriptedKey(c.key, true); break;
+        case Op::KeyUp:   Input::setScriptedKey(c.key, false); break;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL3/SDL.h>
+
+// Frame-stamped input for headless runs, fed into Input's scripted mode.
+//
+// One command per line, '#' starts a comment:
+//   <frame> mouse <x> <y>            move the cursor
+//   <frame> press <left|right>       hold a mouse button
+//   <frame> release <left|right>
+//   <frame> key <ScancodeName> <down|up>   e.g. "120 key E down"
+// Commands run at the start of their frame, before Input::update().
+class InputScript {
+public:
+    bool load(const std::string& path);
+
+    // Apply every command scheduled for this frame
+    void apply(int frame);
+
+    // Last frame that has a command (-1 if empty)
+    int lastFrame() const { return commands_.empty() ? -1 : commands_.back().frame; }
+
+private:
+    enum class Op { Mouse, Press, Release, KeyDown, KeyUp };
+
+    struct Command {
+        int          frame;
+        Op           op;
+        float        x, y;
+        Uint32       button;
+        SDL_Scancode key;
+    };
+
+    std::vector<Command> commands_; // sorted by frame
+    size_t next_ = 0;
+};
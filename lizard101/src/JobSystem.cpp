@@ -1,4 +1,5 @@
 #include "JobSystem.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 
@@ -37,4 +38,88 @@ void worker(SharedData& data, const JobQueue& jobs, JobType type) {
             }
         }
     }
-}
\ No newline at end of file
+}
+
+// ----------------- WorkerPool -----------------
+
+WorkerPool& WorkerPool::getInstance() {
+    static WorkerPool instance;
+    return instance;
+}
+
+void WorkerPool::start(unsigned numThreads) {
+    if (running()) return;
+
+    if (numThreads == 0) {
+        const unsigned cores = std::thread::hardware_concurrency();
+        numThreads = (cores > 1) ? cores - 1 : 1;
+    }
+
+    quit_ = false;
+    for (unsigned i = 0; i < numThreads; ++i) {
+        threads_.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+void WorkerPool::stop() {
+    if (!running()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        quit_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : threads_) t.join();
+    threads_.clear();
+}
+
+bool WorkerPool::runChunk() {
+    const size_t begin = next_.fetch_add(1) * chunk_;
+    if (begin >= count_) return false;
+    (*fn_)(begin, std::min(begin + chunk_, count_));
+    return true;
+}
+
+void WorkerPool::workerLoop() {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [&] { return quit_ || (open_ && batch_ != seen); });
+        if (quit_) return;
+
+        seen = batch_;
+        ++active_;
+        lock.unlock();
+        while (runChunk()) {}
+        lock.lock();
+        if (--active_ == 0) done_.notify_all();
+    }
+}
+
+void WorkerPool::parallelFor(size_t count, size_t chunkSize, const RangeFn& fn) {
+    if (count == 0) return;
+    if (chunkSize == 0) chunkSize = 1;
+    if (!running() || count <= chunkSize) {
+        fn(0, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        fn_ = &fn;
+        count_ = count;
+        chunk_ = chunkSize;
+        next_ = 0;
+        ++batch_;
+        open_ = true;
+    }
+    wake_.notify_all();
+
+    while (runChunk()) {}
+
+    // Every chunk is claimed; close the batch and wait for workers still running theirs
+    std::unique_lock<std::mutex> lock(mutex_);
+    open_ = false;
+    done_.wait(lock, [&] { return active_ == 0; });
+    fn_ = nullptr;
+}
@@ -1,5 +1,11 @@
 #pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include "SharedData.hpp"
 
@@ -8,4 +14,51 @@ using JobQueue = std::vector<Job>;
 
 enum class JobType { Input, Network, Collision };
 
-void worker(SharedData& data, const JobQueue& jobs, JobType type);
\ No newline at end of file
+void worker(SharedData& data, const JobQueue& jobs, JobType type);
+
+// Persistent worker threads for data-parallel loops (EntityManager's parallel update).
+// parallelFor splits [0, count) into chunks of chunkSize; the calling thread takes chunks
+// too, and the call returns once every chunk has run. Call from the main thread only.
+class WorkerPool {
+public:
+    using RangeFn = std::function<void(size_t begin, size_t end)>;
+
+    static WorkerPool& getInstance();
+
+    // Spin up the worker threads (0 = one per core, minus the calling thread)
+    void start(unsigned numThreads = 0);
+    void stop();
+
+    bool     running() const { return !threads_.empty(); }
+    unsigned threadCount() const { return static_cast<unsigned>(threads_.size()); }
+
+    // Runs fn over [0, count) in chunks. Runs inline if the pool isn't started or there is
+    // only one chunk.
+    void parallelFor(size_t count, size_t chunkSize, const RangeFn& fn);
+
+private:
+    WorkerPool() = default;
+    ~WorkerPool() { stop(); }
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    void workerLoop();
+    bool runChunk(); // false once every chunk of the batch is claimed
+
+    std::vector<std::thread> threads_;
+
+    // guarded by mutex_
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    uint64_t batch_ = 0;
+    bool     open_ = false;   // workers may still join the current batch
+    unsigned active_ = 0;     // workers inside the current batch
+    bool     quit_ = false;
+
+    // current batch; written under mutex_ before it opens
+    const RangeFn*      fn_ = nullptr;
+    size_t              count_ = 0;
+    size_t              chunk_ = 1;
+    std::atomic<size_t> next_{ 0 }; // next chunk to claim
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Slab allocator for one object type. Memory comes in slabs of kSlabSize objects and is
+// never handed back to the heap; destroyed objects go on a LIFO free list, so the next
+// create() reuses the slot that was freed most recently (still warm in cache).
+//
+// One pool per type, reached through instance(). Not thread safe: create and destroy from
+// the main thread (EntityCommandBuffer for anything that runs during updates).
+template <typename T>
+class ObjectPool {
+public:
+    // Deliberately leaked: entities and components are destroyed from other singletons'
+    // destructors at exit, so the pool must never be torn down before them
+    static ObjectPool& instance() {
+        static ObjectPool* pool = new ObjectPool();
+        return *pool;
+    }
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (free_.empty()) grow();
+        void* mem = free_.back();
+        free_.pop_back();
+        ++inUse_;
+        return new (mem) T(std::forward<Args>(args)...);
+    }
+
+    void destroy(T* obj) {
+        if (!obj) return;
+        obj->~T();
+        free_.push_back(obj);
+        --inUse_;
+    }
+
+    size_t inUse() const { return inUse_; }
+    size_t capacity() const { return slabs_.size() * kSlabSize; }
+
+private:
+    static constexpr size_t kSlabSize = 64;
+
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+    };
+
+    ObjectPool() = default;
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    void grow() {
+        slabs_.emplace_back(new Slot[kSlabSize]);
+        Slot* slab = slabs_.back().get();
+        // Pushed in reverse so the slab is handed out front to back
+        for (size_t i = kSlabSize; i-- > 0;) free_.push_back(&slab[i]);
+    }
+
+    std::vector<std::unique_ptr<Slot[]>> slabs_;
+    std::vector<void*> free_;
+    size_t inUse_ = 0;
+};
@@ -0,0 +1,101 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+
+SpriteBatch& SpriteBatch::getInstance() {
+    static SpriteBatch instance;
+    return instance;
+}
+
+void SpriteBatch::begin() {
+    quads_.clear();
+    layerBase_ = 0;
+}
+
+void SpriteBatch::submit(SDL_Texture* texture, const SDL_FRect* src, const SDL_FRect& dst,
+    SDL_Color color, int layer) {
+    if (!texture) return;
+    quads_.push_back(Quad{ layerBase_ + layer, texture, src == nullptr, src ? *src : SDL_FRect{ 0, 0, 0, 0 }, dst, color });
+}
+
+void SpriteBatch::submitRect(const SDL_FRect& dst, SDL_Color color, int layer) {
+    quads_.push_back(Quad{ layerBase_ + layer, nullptr, false, SDL_FRect{ 0, 0, 0, 0 }, dst, color });
+}
+
+static bool sameColor(const SDL_Color& a, const SDL_Color& b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+void SpriteBatch::flush(SDL_Renderer* renderer) {
+    stats_ = Stats{};
+
+    // Layer only: stable keeps submit order inside a layer, so it stays the draw order.
+    // Runs below batch whatever is already adjacent.
+    std::stable_sort(quads_.begin(), quads_.end(), [](const Quad& a, const Quad& b) {
+        return a.layer < b.layer;
+        });
+
+    size_t i = 0;
+    while (i < quads_.size()) {
+        size_t j = i + 1;
+        if (quads_[i].texture) {
+            while (j < quads_.size() && quads_[j].layer == quads_[i].layer && quads_[j].texture == quads_[i].texture) ++j;
+            flushTextureRun(renderer, i, j);
+        }
+        else {
+            while (j < quads_.size() && quads_[j].layer == quads_[i].layer && !quads_[j].texture &&
+                sameColor(quads_[j].color, quads_[i].color)) ++j;
+            flushRectRun(renderer, i, j);
+        }
+        i = j;
+    }
+
+    quads_.clear();
+}
+
+void SpriteBatch::flushTextureRun(SDL_Renderer* renderer, size_t begin, size_t end) {
+    SDL_Texture* texture = quads_[begin].texture;
+    float tw = 0, th = 0;
+    SDL_GetTextureSize(texture, &tw, &th);
+    if (tw <= 0 || th <= 0) return;
+
+    vertices_.clear();
+    indices_.clear();
+    for (size_t q = begin; q < end; ++q) {
+        const Quad& quad = quads_[q];
+        const SDL_FRect src = quad.wholeTexture ? SDL_FRect{ 0, 0, tw, th } : quad.src;
+        const float u0 = src.x / tw, v0 = src.y / th;
+        const float u1 = (src.x + src.w) / tw, v1 = (src.y + src.h) / th;
+        const float x0 = quad.dst.x, y0 = quad.dst.y;
+        const float x1 = quad.dst.x + quad.dst.w, y1 = quad.dst.y + quad.dst.h;
+        const SDL_FColor c{ quad.color.r / 255.0f, quad.color.g / 255.0f, quad.color.b / 255.0f, quad.color.a / 255.0f };
+
+        const int base = static_cast<int>(vertices_.size());
+        vertices_.push_back(SDL_Vertex{ { x0, y0 }, c, { u0, v0 } });
+        vertices_.push_back(SDL_Vertex{ { x1, y0 }, c, { u1, v0 } });
+        vertices_.push_back(SDL_Vertex{ { x1, y1 }, c, { u1, v1 } });
+        vertices_.push_back(SDL_Vertex{ { x0, y1 }, c, { u0, v1 } });
+        const int idx[6] = { base, base + 1, base + 2, base, base + 2, base + 3 };
+        indices_.insert(indices_.end(), idx, idx + 6);
+    }
+
+    SDL_RenderGeometry(renderer, texture,
+        vertices_.data(), static_cast<int>(vertices_.size()),
+        indices_.data(), static_cast<int>(indices_.size()));
+    stats_.quads += static_cast<int>(end - begin);
+    stats_.geometryCalls++;
+}
+
+void SpriteBatch::flushRectRun(SDL_Renderer* renderer, size_t begin, size_t end) {
+    rects_.clear();
+    for (size_t q = begin; q < end; ++q) {
+        rects_.push_back(quads_[q].dst);
+    }
+
+    const SDL_Color& c = quads_[begin].color;
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+    SDL_RenderFillRects(renderer, rects_.data(), static_cast<int>(rects_.size()));
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    stats_.rects += static_cast<int>(end - begin);
+    stats_.fillCalls++;
+}
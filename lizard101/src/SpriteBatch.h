@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+#include <SDL3/SDL.h>
+
+// Per-frame sprite batch.
+// Components submit quads during EntityManager::renderAll instead of drawing directly.
+// At flush the buffer is stable-sorted by layer and drawn as one SDL_RenderGeometry call per
+// run of adjacent quads sharing a texture and one SDL_RenderFillRects call per run of
+// adjacent rects sharing a color.
+// Lower layers draw first; inside a layer quads draw in submit order. Submitting same-texture
+// quads together (e.g. from an atlas) keeps the runs long.
+// EntityManager::renderAll offsets submitted layers by the entity's RenderLayer (see setLayerBase).
+class SpriteBatch {
+public:
+    static SpriteBatch& getInstance();
+
+    // Batch layers reserved per entity RenderLayer
+    static constexpr int kLayerStride = 1000;
+
+    struct Stats {
+        int quads = 0;          // textured quads submitted
+        int rects = 0;          // solid rects submitted
+        int geometryCalls = 0;  // SDL_RenderGeometry calls issued
+        int fillCalls = 0;      // SDL_RenderFillRects calls issued
+    };
+
+    // Start a new frame (drops anything not flushed)
+    void begin();
+
+    // Added to the layer of every following submit (reset by begin)
+    void setLayerBase(int base) { layerBase_ = base; }
+
+    // Textured quad. src == nullptr means the whole texture. color modulates the texture.
+    void submit(SDL_Texture* texture, const SDL_FRect* src, const SDL_FRect& dst,
+        SDL_Color color = SDL_Color{ 255, 255, 255, 255 }, int layer = 0);
+
+    // Solid alpha-blended rect
+    void submitRect(const SDL_FRect& dst, SDL_Color color, int layer = 0);
+
+    // Sort and draw everything submitted since begin()
+    void flush(SDL_Renderer* renderer);
+
+    const Stats& lastStats() const { return stats_; }
+
+private:
+    SpriteBatch() = default;
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    struct Quad {
+        int          layer;
+        SDL_Texture* texture;  // nullptr = solid rect
+        bool         wholeTexture;
+        SDL_FRect    src;
+        SDL_FRect    dst;
+        SDL_Color    color;
+    };
+
+    void flushTextureRun(SDL_Renderer* renderer, size_t begin, size_t end);
+    void flushRectRun(SDL_Renderer* renderer, size_t begin, size_t end);
+
+    std::vector<Quad> quads_;
+    int layerBase_ = 0;
+
+    // scratch buffers, reused across frames
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int>        indices_;
+    std::vector<SDL_FRect>  rects_;
+
+    Stats stats_;
+};
@@ -0,0 +1,152 @@
+#include "TextureAtlas.h"
+#include "AssetPack.h"
+#include <algorithm>
+#include <fstream>
+#include <unordered_set>
+
+TextureAtlas& TextureAtlas::getInstance() {
+    static TextureAtlas instance;
+    return instance;
+}
+
+int TextureAtlas::build(SDL_Renderer* renderer, const std::vector<std::string>& paths,
+    int pageSize, int maxEntry) {
+    clear();
+    if (!TextureCache::getInstance().decodeEnabled()) return 0;
+    renderer_ = renderer;
+
+    // Respect the renderer's texture size limit
+    const int maxTex = static_cast<int>(SDL_GetNumberProperty(
+        SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0));
+    if (maxTex > 0 && pageSize > maxTex) pageSize = maxTex;
+
+    const int pad = 2; // gap between entries so linear filtering doesn't bleed
+
+    struct Pending {
+        std::string  path;
+        SDL_Surface* surface;
+        float        scale;
+    };
+    std::vector<Pending> pending;
+    std::unordered_set<std::string> seen;
+
+    // --- Decode (and optionally downscale) ---
+    for (const auto& path : paths) {
+        if (path.empty() || !seen.insert(path).second) continue;
+
+        SDL_Surface* s = AssetPack::getInstance().loadSurface(path);
+        if (!s) {
+            SDL_Log("TextureAtlas: failed to load '%s': %s", path.c_str(), SDL_GetError());
+            continue;
+        }
+
+        float scale = AssetPack::getInstance().scaleOf(path); // the pack may have pre-scaled it
+        if (maxEntry > 0 && (s->w > maxEntry || s->h > maxEntry)) {
+            const float k = std::min(maxEntry / static_cast<float>(s->w), maxEntry / static_cast<float>(s->h));
+            const int w = std::max(1, static_cast<int>(s->w * k));
+            const int h = std::max(1, static_cast<int>(s->h * k));
+            if (SDL_Surface* scaled = SDL_ScaleSurface(s, w, h, SDL_SCALEMODE_LINEAR)) {
+                scale *= static_cast<float>(w) / static_cast<float>(s->w);
+                SDL_DestroySurface(s);
+                s = scaled;
+            }
+        }
+
+        if (s->w + pad > pageSize || s->h + pad > pageSize) {
+            SDL_Log("TextureAtlas: '%s' (%dx%d) does not fit a %d page, skipping", path.c_str(), s->w, s->h, pageSize);
+            SDL_DestroySurface(s);
+            continue;
+        }
+        pending.push_back(Pending{ path, s, scale });
+    }
+
+    // Tallest first packs shelves tighter
+    std::stable_sort(pending.begin(), pending.end(), [](const Pending& a, const Pending& b) {
+        return a.surface->h > b.surface->h;
+        });
+
+    // --- Shelf packing ---
+    std::vector<SDL_Surface*> pageSurfaces;
+    int shelfX = 0, shelfY = 0, shelfH = 0;
+
+    for (auto& p : pending) {
+        const int w = p.surface->w;
+        const int h = p.surface->h;
+
+        if (shelfX + w + pad > pageSize) {
+            shelfY += shelfH;
+            shelfX = 0;
+            shelfH = 0;
+        }
+        if (pageSurfaces.empty() || shelfY + h + pad > pageSize) {
+            SDL_Surface* page = SDL_CreateSurface(pageSize, pageSize, SDL_PIXELFORMAT_RGBA32);
+            if (!page) {
+                SDL_Log("TextureAtlas: failed to create page: %s", SDL_GetError());
+                break;
+            }
+            pageSurfaces.push_back(page);
+            shelfX = shelfY = shelfH = 0;
+        }
+
+        SDL_Rect dst{ shelfX, shelfY, w, h };
+        SDL_SetSurfaceBlendMode(p.surface, SDL_BLENDMODE_NONE); // copy alpha as-is
+        SDL_BlitSurface(p.surface, nullptr, pageSurfaces.back(), &dst);
+
+        AtlasRegion region;
+        region.pageIndex = static_cast<int>(pageSurfaces.size()) - 1;
+        region.rect = SDL_FRect{ static_cast<float>(shelfX), static_cast<float>(shelfY),
+                                 static_cast<float>(w), static_cast<float>(h) };
+        region.scale = p.scale;
+        regions_[p.path] = region;
+
+        shelfX += w + pad;
+        shelfH = std::max(shelfH, h + pad);
+    }
+
+    for (auto& p : pending) SDL_DestroySurface(p.surface);
+
+    // --- Upload pages ---
+    for (SDL_Surface* page : pageSurfaces) {
+        SDL_Texture* t = SDL_CreateTextureFromSurface(renderer, page);
+        SDL_DestroySurface(page);
+        if (!t) SDL_Log("TextureAtlas: failed to upload page: %s", SDL_GetError());
+        pages_.push_back(TextureHandle(t, SDL_DestroyTexture));
+    }
+
+    for (auto it = regions_.begin(); it != regions_.end(); ) {
+        it->second.page = pages_[it->second.pageIndex];
+        if (!it->second.page) it = regions_.erase(it);
+        else ++it;
+    }
+
+    SDL_Log("TextureAtlas: packed %d images into %d page(s) of %dx%d",
+        static_cast<int>(regions_.size()), static_cast<int>(pages_.size()), pageSize, pageSize);
+    return static_cast<int>(regions_.size());
+}
+
+const AtlasRegion* TextureAtlas::find(SDL_Renderer* renderer, const std::string& filePath) const {
+    if (renderer != renderer_) return nullptr;
+    auto it = regions_.find(filePath);
+    return (it != regions_.end()) ? &it->second : nullptr;
+}
+
+bool TextureAtlas::writeManifest(const std::string& manifestPath) const {
+    std::ofstream out(manifestPath);
+    if (!out) {
+        SDL_Log("TextureAtlas: cannot write manifest '%s'", manifestPath.c_str());
+        return false;
+    }
+    for (const auto& kv : regions_) {
+        const AtlasRegion& r = kv.second;
+        out << kv.first << ' ' << r.pageIndex << ' '
+            << r.rect.x << ' ' << r.rect.y << ' ' << r.rect.w << ' ' << r.rect.h << ' '
+            << r.scale << '\n';
+    }
+    return true;
+}
+
+void TextureAtlas::clear() {
+    regions_.clear();
+    pages_.clear();
+    renderer_ = nullptr;
+}
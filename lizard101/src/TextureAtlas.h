@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <SDL3/SDL.h>
+
+#include "TextureCache.h"
+
+// Where an image lives inside the atlas
+struct AtlasRegion {
+    TextureHandle page;     // atlas page texture (shared with every TextureRenderer using it)
+    int           pageIndex = 0;
+    SDL_FRect     rect{ 0, 0, 0, 0 }; // sub-rect inside the page
+    float         scale = 1.0f;       // rect size / original image size (< 1 if downscaled)
+};
+
+// Startup-time atlas packer. Packs many small images (card art, sprites) into a few large
+// pages so TextureRenderer draws them as sub-rects of one texture instead of binding a
+// separate texture per image.
+class TextureAtlas {
+public:
+    static TextureAtlas& getInstance();
+
+    // Decode and shelf-pack the given images into pages of (at most) pageSize x pageSize.
+    // Images bigger than maxEntry in either dimension are downscaled to fit (0 = never scale).
+    // Files that fail to load or cannot fit on a page are skipped and keep using TextureCache.
+    // Returns the number of images packed.
+    int build(SDL_Renderer* renderer, const std::vector<std::string>& paths,
+        int pageSize = 4096, int maxEntry = 0);
+
+    // Region for filePath, or nullptr if it is not in the atlas
+    const AtlasRegion* find(SDL_Renderer* renderer, const std::string& filePath) const;
+
+    // Writes "path page x y w h scale" per line
+    bool writeManifest(const std::string& manifestPath) const;
+
+    size_t pageCount() const { return pages_.size(); }
+
+    // Release all pages (call before destroying the renderer)
+    void clear();
+
+private:
+    TextureAtlas() = default;
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    SDL_Renderer* renderer_ = nullptr;
+    std::vector<TextureHandle> pages_;
+    std::unordered_map<std::string, AtlasRegion> regions_;
+};
@@ -0,0 +1,72 @@
+#include "TextureCache.h"
+#include "AssetPack.h"
+#include <SDL3_image/SDL_image.h>
+
+TextureCache& TextureCache::getInstance() {
+    static TextureCache instance;
+    return instance;
+}
+
+TextureHandle TextureCache::acquire(SDL_Renderer* renderer, const std::string& filePath) {
+    if (TextureHandle live = find(renderer, filePath)) {
+        return live;
+    }
+    if (!decodeEnabled_) return nullptr;
+
+    SDL_Texture* raw = nullptr;
+    if (AssetPack::getInstance().contains(filePath)) {
+        // Pre-decoded: straight upload from the mapped pack, no decode
+        if (SDL_Surface* s = AssetPack::getInstance().loadSurface(filePath)) {
+            raw = SDL_CreateTextureFromSurface(renderer, s);
+            SDL_DestroySurface(s);
+        }
+    }
+    else {
+        raw = IMG_LoadTexture(renderer, filePath.c_str());
+    }
+    if (!raw) {
+        SDL_Log("TextureCache: failed to load '%s': %s", filePath.c_str(), SDL_GetError());
+        return nullptr;
+    }
+    return adopt(renderer, filePath, raw);
+}
+
+TextureHandle TextureCache::find(SDL_Renderer* renderer, const std::string& filePath) const {
+    auto r = textures_.find(renderer);
+    if (r == textures_.end()) return nullptr;
+    auto it = r->second.find(filePath);
+    return (it != r->second.end()) ? it->second.lock() : nullptr;
+}
+
+TextureHandle TextureCache::adopt(SDL_Renderer* renderer, const std::string& filePath, SDL_Texture* texture) {
+    if (!texture) return nullptr;
+
+    // Last handle out destroys the texture and drops the cache slot
+    TextureHandle handle(texture, [this, renderer, filePath](SDL_Texture* t) {
+        evict(renderer, filePath);
+        SDL_DestroyTexture(t);
+        });
+    textures_[renderer][filePath] = handle;
+    return handle;
+}
+
+void TextureCache::evict(SDL_Renderer* renderer, const std::string& filePath) {
+    auto r = textures_.find(renderer);
+    if (r == textures_.end()) return;
+
+    auto it = r->second.find(filePath);
+    if (it != r->second.end() && it->second.expired()) {
+        r->second.erase(it);
+    }
+    if (r->second.empty()) {
+        textures_.erase(r);
+    }
+}
+
+size_t TextureCache::size() const {
+    size_t n = 0;
+    for (const auto& kv : textures_) {
+        n += kv.second.size();
+    }
+    return n;
+}
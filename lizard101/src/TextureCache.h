@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <SDL3/SDL.h>
+
+// Shared handle to a cached texture. The texture is destroyed (and evicted from the cache)
+// when the last handle goes away.
+using TextureHandle = std::shared_ptr<SDL_Texture>;
+
+// Engine-level texture cache keyed by file path (per renderer).
+// Many entities showing the same image share one decoded GPU texture.
+class TextureCache {
+public:
+    static TextureCache& getInstance();
+
+    // Returns a shared handle for filePath, decoding it only if no live handle exists.
+    // Returns an empty handle if the file could not be loaded.
+    TextureHandle acquire(SDL_Renderer* renderer, const std::string& filePath);
+
+    // Live handle for filePath if one exists, without loading anything
+    TextureHandle find(SDL_Renderer* renderer, const std::string& filePath) const;
+
+    // Take ownership of an already created texture (e.g. uploaded by AssetLoader) under filePath
+    TextureHandle adopt(SDL_Renderer* renderer, const std::string& filePath, SDL_Texture* texture);
+
+    // Number of distinct textures currently alive in the cache
+    size_t size() const;
+
+    // Headless runs turn decoding off: acquire() then returns empty handles without touching
+    // the disk, and TextureRenderer falls back to its red box
+    void setDecodeEnabled(bool enabled) { decodeEnabled_ = enabled; }
+    bool decodeEnabled() const { return decodeEnabled_; }
+
+private:
+    TextureCache() = default;
+    TextureCache(const TextureCache&) = delete;
+    TextureCache& operator=(const TextureCache&) = delete;
+
+    void evict(SDL_Renderer* renderer, const std::string& filePath);
+
+    std::unordered_map<SDL_Renderer*, std::unordered_map<std::string, std::weak_ptr<SDL_Texture>>> textures_;
+    bool decodeEnabled_ = true;
+};
@@ -3,7 +3,7 @@
 #include <SDL3/SDL.h>
 
 Timeline::Timeline(float scale)
-	: ticSize(scale), elapsedTime(0.0f), currentDelta(0.0f), paused(false)
+	: ticSize(scale), elapsedTime(0.0f), currentDelta(0.0f), paused(false), fixedStep(0.0f)
 {
 	lastTick = static_cast<float>(SDL_GetTicks());
 }
@@ -16,7 +16,7 @@ void Timeline::update() {
 	}
 
 	float currentTick = static_cast<float>(SDL_GetTicks());
-	float rawDelta = (currentTick - lastTick) / 1000.0f;
+	float rawDelta = (fixedStep > 0.0f) ? fixedStep : (currentTick - lastTick) / 1000.0f;
 	currentDelta = rawDelta * ticSize;
 	elapsedTime += currentDelta;
 	lastTick = currentTick;
@@ -42,6 +42,10 @@ void Timeline::setScale(float scale) {
 	ticSize = scale;
 }
 
+void Timeline::setFixedStep(float seconds) {
+	fixedStep = seconds;
+}
+
 float Timeline::getDeltaTime() const {
 	return currentDelta;
 }
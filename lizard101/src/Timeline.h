@@ -7,6 +7,7 @@ private:
 	float lastTick;
 	float currentDelta;
 	bool paused;
+	float fixedStep; // > 0: every update advances by this many seconds instead of wall time
 
 public:
 	float getDeltaTime() const;
@@ -18,6 +19,7 @@ public:
 	void unpause();
 	void togglePause();
 	void setScale(float scale);
+	void setFixedStep(float seconds);
 	float getElapsedTime() const;
 	float getTicSize() const;
 	bool isPaused() const;
@@ -58,6 +58,14 @@ static std::mutex updateEntityMutex;
 // Ensure only one send/recv pair uses the dedicated REQ socket at a time
 static std::mutex reqMutex;
 
+// The collision job walks this copy of the death-zone view and the local player resolved
+// with it, never the live manager: the main thread's addEntity/removeEntity rewrite the view
+// and the name index while the job runs. Held by the job while it uses them and by the main
+// thread while it snapshots them and while it adds/removes entities.
+static std::mutex deathZonesMutex;
+static std::vector<Entity*> deathZones;
+static Entity* collisionPlayer = nullptr;
+
 bool gEventLogEnabled = true;
 
 bool localPlayerNeedsRespawn = false;
@@ -292,10 +300,8 @@ int main(int argc, char* argv[]) {
     PauseButton::onPauseRequested = []() { pauseRequested.store(1); };
 
     // Subscribe to input events and send them to the server
-    eventManager.subscribe(EventType::Input, [&](const Event& e) {
-        if (auto* ia = std::get_if<InputAction>(&e.payload)) {
-            sendInputEvent(reqSock, playerName, ia->action, ia->pressed);
-        }
+    eventManager.subscribe<InputAction>([&](const InputAction& ia) {
+        sendInputEvent(reqSock, playerName, ia.action, ia.pressed);
         });
 
     // Main loop
@@ -317,12 +323,7 @@ int main(int argc, char* argv[]) {
         const bool curJump = Input::isKeyPressed(SDL_SCANCODE_W) || Input::isKeyPressed(SDL_SCANCODE_SPACE);
 
         auto raiseInput = [&](InputAction::Kind kind, bool pressed) {
-            eventManager.raise(Event{
-                EventType::Input,
-                EventPriority::High,
-                0.0f,
-                EventPayload{ InputAction{ kind, pressed, playerName } }
-                });
+            eventManager.raise(InputAction{ kind, pressed }, EventPriority::High);
             };
 
         if (curA != prevA) { raiseInput(InputAction::Kind::MoveLeft, curA); prevA = curA; }
@@ -338,38 +339,33 @@ int main(int argc, char* argv[]) {
     collisionJobs.push_back([&]() {
         std::cout << "[Job] Collision job started" << std::endl;
 
-        Entity* localPlayer = manager.findEntityByName(playerName);
+        std::lock_guard<std::mutex> zonesLock(deathZonesMutex);
+        Entity* localPlayer = collisionPlayer;
         if (!localPlayer) {
             std::cout << "[Job] Collision job complete (no local player)" << std::endl;
             return;
         }
-        auto& entities = manager.entities;
 
         bool playerInDeathZone = false; 
         bool playerWasInDeathZone = false;
 
-        for (auto* other : entities) {
-            // Only check for death zones here; all other collision handling is done via the event system
-            if (!other->getComponent<DeathZone>() && (other == localPlayer || !other->isSolid)) continue;
-
+        // Only check death zones here; all other collision handling is done via the event system
+        for (auto* other : deathZones) {
             if (collisionDetection(*localPlayer, *other)) {
-
-                if (other->hasTag("DEATH")) {
-                    playerInDeathZone = true;
-                    if (!playerWasInDeathZone) {
-                        localPlayerNeedsRespawn = true;
-                        std::ostringstream deathData;
-                            deathData << localPlayer->name << "," << other->name;
-                            // suppress repeated Death sends for a short window
-                            {
-                                long long last = lastDeathSentMs.load();
-                                long long now = nowMs();
-                                if (now - last >= 250) {
-                                    send_event(reqSock, playerName, "Death", deathData.str());
-                                    lastDeathSentMs.store(now);
-                                }
+                playerInDeathZone = true;
+                if (!playerWasInDeathZone) {
+                    localPlayerNeedsRespawn = true;
+                    std::ostringstream deathData;
+                        deathData << localPlayer->name << "," << other->name;
+                        // suppress repeated Death sends for a short window
+                        {
+                            long long last = lastDeathSentMs.load();
+                            long long now = nowMs();
+                            if (now - last >= 250) {
+                                send_event(reqSock, playerName, "Death", deathData.str());
+                                lastDeathSentMs.store(now);
                             }
-                    }
+                        }
                 }
             }
         }
@@ -377,6 +373,13 @@ int main(int argc, char* argv[]) {
         std::cout << "[Job] Collision job complete" << std::endl;
         });
 
+    // Caller holds deathZonesMutex
+    auto snapshotCollisionTargets = [&]() {
+        const auto& zones = manager.view<DeathZone>(TAG_DEATH);
+        deathZones.assign(zones.begin(), zones.end());
+        collisionPlayer = manager.findEntityByName(playerName);
+        };
+
     std::thread inputThread(worker, std::ref(sharedData), std::cref(inputJobs), JobType::Input);
     std::thread collisionThread(worker, std::ref(sharedData), std::cref(collisionJobs), JobType::Collision);
 
@@ -391,6 +394,12 @@ int main(int argc, char* argv[]) {
         std::cout << "[Main] New frame" << std::endl;
 
         std::cout << "[Main] Entity count: " << manager.entities.size() << std::endl;
+        // Snapshot the death zones and the local player for this frame's collision job before it starts
+        {
+            std::lock_guard<std::mutex> zonesLock(deathZonesMutex);
+            snapshotCollisionTargets();
+        }
+
         //Reset job indices at the start of each frame
         {
             std::unique_lock<std::mutex> lock(sharedData.frameMutex);
@@ -426,7 +435,7 @@ int main(int argc, char* argv[]) {
                 // if we recently sent a Death event, skip updates for a short window to avoid overwriting server respawn
                 long long last = lastDeathSentMs.load();
                 if (nowMs() - last >= 300) {
-                    send_update(reqSock, playerName, localPlayer->x, localPlayer->y);
+                    send_update(reqSock, playerName, localPlayer->getX(), localPlayer->getY());
                     lastSendTime = elapsedTime;
                 }
             }
@@ -460,7 +469,7 @@ int main(int argc, char* argv[]) {
         }
 
         manager.updateAll(deltaTime);
-        physics.updatePhysics(manager, deltaTime);
+        physics.updatePhysics(deltaTime);
 
         Entity* localPlayer = manager.findEntityByName(playerName);
         if (localPlayer) {
@@ -468,7 +477,7 @@ int main(int argc, char* argv[]) {
                 if (other == localPlayer || !other->isSolid) continue;
                 if (collisionDetection(*localPlayer, *other)) {
                     // Example death zone check
-                    if (other->hasTag("DEATH") && !deathEventSentThisFrame) {
+                    if (other->hasTag(TAG_DEATH) && !deathEventSentThisFrame) {
                         localPlayerNeedsRespawn = true;
                         std::ostringstream deathData;
                         deathData << localPlayer->name << "," << other->name;
@@ -483,6 +492,8 @@ int main(int argc, char* argv[]) {
         // Apply pending network updates on main thread
         {
             std::lock_guard<std::mutex> lock(updateEntityMutex);
+            // Entities come and go here; keep the collision job out of the zones meanwhile
+            std::lock_guard<std::mutex> zonesLock(deathZonesMutex);
 
             // 1. Collect all entity names from the latest server state
             std::unordered_set<std::string> serverEntityNames;
@@ -521,16 +532,16 @@ int main(int argc, char* argv[]) {
                 if (e) {
                     if (name == playerName) {
                         if (localPlayerNeedsRespawn) {
-                            e->x = x;
-                            e->y = y;
+                            e->setX(x);
+                            e->setY(y);
                             localPlayerNeedsRespawn = false;
                         }
                     }
                     else {
-                        e->x = x;
-                        e->y = y;
-                        e->width = w;
-                        e->height = h;
+                        e->setX(x);
+                        e->setY(y);
+                        e->setWidth(w);
+                        e->setHeight(h);
                     }
                 }
                 else {
@@ -592,17 +603,18 @@ int main(int argc, char* argv[]) {
             }
 
             // 4. Remove local entities not present in server state or static set (except local player)
-            auto& entities = manager.entities;
-            for (auto it = entities.begin(); it != entities.end(); ) {
-                Entity* e = *it;
+            // Collect first: removeEntity reorders the dense entity array
+            std::vector<Entity*> stale;
+            for (Entity* e : manager.entities) {
                 if (serverEntityNames.find(e->name) == serverEntityNames.end()) {
-                    delete e;
-                    it = entities.erase(it);
-                }
-                else {
-                    ++it;
+                    stale.push_back(e);
                 }
             }
+            for (Entity* e : stale) {
+                manager.removeEntity(e);
+            }
+            // A job that starts after this point must not see the removed entities
+            snapshotCollisionTargets();
 
             pendingUpdates.clear();
         }
@@ -638,6 +650,9 @@ int main(int argc, char* argv[]) {
     inputThread.join();
     collisionThread.join();
 
+    // Players unsubscribe from eventManager when destroyed, so destroy them while it is alive
+    manager.destroyAll();
+
     if (playerTexture) SDL_DestroyTexture(playerTexture);
     if (platformTexture) SDL_DestroyTexture(platformTexture);
     if (skullTexture) SDL_DestroyTexture(skullTexture);
@@ -1,13 +1,38 @@
 #pragma once
 #include <SDL3/SDL.h>
+#include <cstdint>
+#include "ComponentType.h"
 
 // Forward declare the engine's Entity type
 struct Entity;
 
 namespace ecs {
 
+    class SystemRegistry;
+
+    // Order of the component update passes (see SystemRegistry)
+    enum class UpdatePhase : uint8_t {
+        Input = 0,
+        Movement,
+        Collision,
+        Gameplay,
+        Animation,
+        Count
+    };
+
+    // Whether an update may run on a worker thread during a parallel update
+    enum class ThreadAccess : uint8_t {
+        MainThread = 0, // may touch other entities, the EntityManager or singletons
+        OwnerOnly       // only reads/writes its own state and its owner's transform
+    };
+
     class Component {
     public:
+        // Derived types override this to pick their update pass
+        static constexpr UpdatePhase kUpdatePhase = UpdatePhase::Gameplay;
+        // ...and OwnerOnly to let that pass be split across worker threads
+        static constexpr ThreadAccess kThreadAccess = ThreadAccess::MainThread;
+
         virtual ~Component() {}
         virtual void onStart() {}
         virtual void onUpdate(float /*dt*/) {}
@@ -17,9 +42,13 @@ namespace ecs {
 
     private:
         friend struct ::Entity;
-        void attachOwner(::Entity* e) { owner_ = e; }
+        friend class SystemRegistry;
+        void attachOwner(::Entity* e, ComponentTypeId typeId) { owner_ = e; typeId_ = typeId; }
 
         Entity* owner_ = nullptr;
+        ComponentTypeId typeId_ = 0;
+        static constexpr uint32_t kNotScheduled = 0xFFFFFFFFu;
+        uint32_t systemPos_ = kNotScheduled;  // index in its SystemRegistry pass
     };
 
 } // namespace ecs
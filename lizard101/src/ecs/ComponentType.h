@@ -1,12 +1,30 @@
 // ecs/ComponentType.h
 #pragma once
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 using ComponentTypeId = std::size_t;
 
+// Component membership is a bitmask with one bit per component type
+using ComponentMask = std::uint32_t;
+constexpr ComponentTypeId kMaxComponentTypes = 32;
+
 inline ComponentTypeId nextComponentTypeId() {
-    static ComponentTypeId id = 0;
-    return id++;
+    static std::atomic<ComponentTypeId> id{ 0 };
+    const ComponentTypeId next = id++;
+    // Checked in release builds too: a bit past the mask would alias another type's bit
+    if (next >= kMaxComponentTypes) {
+        std::fprintf(stderr, "More than %zu component types; raise kMaxComponentTypes (and widen ComponentMask)\n",
+            kMaxComponentTypes);
+        std::abort();
+    }
+    return next;
 }
 
 template <typename T>
@@ -14,3 +32,22 @@ ComponentTypeId componentTypeId() {
     static ComponentTypeId id = nextComponentTypeId();
     return id;
 }
+
+template <typename T>
+ComponentMask componentBit() {
+    return ComponentMask(1) << componentTypeId<T>();
+}
+
+// Mask with the bit of every listed type set
+template <typename... Ts>
+ComponentMask componentMask() {
+    return (ComponentMask(0) | ... | componentBit<Ts>());
+}
+
+inline unsigned popCount(ComponentMask m) {
+#if defined(_MSC_VER)
+    return __popcnt(m);
+#else
+    return static_cast<unsigned>(__builtin_popcount(m));
+#endif
+}
@@ -0,0 +1,105 @@
+#include "SystemRegistry.h"
+#include "../JobSystem.hpp"
+#include <algorithm>
+
+namespace ecs {
+
+    SystemRegistry& SystemRegistry::getInstance() {
+        static SystemRegistry instance;
+        return instance;
+    }
+
+    void SystemRegistry::addPass(ComponentTypeId id, UpdatePhase phase, ThreadAccess access, const char* name, PassFn run) {
+        passOf_[id] = static_cast<uint32_t>(passes_.size());
+        Pass pass;
+        pass.id = id;
+        pass.phase = phase;
+        pass.access = access;
+        pass.name = name;
+        pass.run = run;
+        passes_.push_back(std::move(pass));
+
+        // A pass added while update() runs gets ordered (and first run) next frame
+        if (updating_) {
+            orderDirty_ = true;
+            return;
+        }
+        order_.push_back(passOf_[id]);
+        std::stable_sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) {
+            return passes_[a].phase < passes_[b].phase;
+        });
+    }
+
+    void SystemRegistry::schedule(Component* c) {
+        if (!c || c->systemPos_ != Component::kNotScheduled) return;
+        if (c->typeId_ >= passOf_.size() || passOf_[c->typeId_] == kNoPass) return;
+        Pass& pass = passes_[passOf_[c->typeId_]];
+        c->systemPos_ = static_cast<uint32_t>(pass.items.size());
+        pass.items.push_back(c);
+    }
+
+    void SystemRegistry::unschedule(Component* c) {
+        if (!c || c->systemPos_ == Component::kNotScheduled) return;
+        Pass& pass = passes_[passOf_[c->typeId_]];
+        if (updating_) {
+            // Keep positions stable while passes run
+            pass.items[c->systemPos_] = nullptr;
+            pass.dirty = true;
+        }
+        else {
+            Component* moved = pass.items.back();
+            pass.items[c->systemPos_] = moved;
+            moved->systemPos_ = c->systemPos_;
+            pass.items.pop_back();
+        }
+        c->systemPos_ = Component::kNotScheduled;
+    }
+
+    void SystemRegistry::compact(Pass& pass) {
+        pass.items.erase(std::remove(pass.items.begin(), pass.items.end(), nullptr), pass.items.end());
+        for (size_t i = 0; i < pass.items.size(); ++i) {
+            pass.items[i]->systemPos_ = static_cast<uint32_t>(i);
+        }
+        pass.dirty = false;
+    }
+
+    void SystemRegistry::update(float dt) {
+        const double toMs = 1000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+        stats_.clear();
+        updating_ = true;
+
+        for (uint32_t index : order_) {
+            Pass& pass = passes_[index];
+            const size_t count = pass.items.size();
+            const bool split = parallel_ && pass.access == ThreadAccess::OwnerOnly && count > kParallelChunk;
+            const Uint64 start = SDL_GetPerformanceCounter();
+            if (split) {
+                // OwnerOnly components never add or remove anything, so items stays put
+                std::vector<Component*>& items = pass.items;
+                const PassFn run = pass.run;
+                WorkerPool::getInstance().parallelFor(count, kParallelChunk, [&items, run, dt](size_t begin, size_t end) {
+                    run(items, begin, end, dt);
+                });
+            }
+            else {
+                pass.run(pass.items, 0, SIZE_MAX, dt);
+            }
+            const Uint64 end = SDL_GetPerformanceCounter();
+            stats_.push_back(PassStats{ pass.name, pass.phase, count, static_cast<double>(end - start) * toMs, split });
+        }
+
+        updating_ = false;
+        for (Pass& pass : passes_) {
+            if (pass.dirty) compact(pass);
+        }
+        if (orderDirty_) {
+            order_.clear();
+            for (uint32_t i = 0; i < passes_.size(); ++i) order_.push_back(i);
+            std::stable_sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) {
+                return passes_[a].phase < passes_[b].phase;
+            });
+            orderDirty_ = false;
+        }
+    }
+
+} // namespace ecs
@@ -0,0 +1,101 @@
+// ecs/SystemRegistry.h
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include "Component.h"
+#include "ComponentType.h"
+
+namespace ecs {
+
+    // One update pass per component type, over a contiguous list of that type's instances.
+    // Passes run in UpdatePhase order (see Component::kUpdatePhase), then in the order the
+    // types were first used. Components are scheduled while their entity is in the
+    // EntityManager; types that don't override onUpdate never get a pass.
+    class SystemRegistry {
+    public:
+        static SystemRegistry& getInstance();
+
+        // Timings of the last update(), one entry per pass in execution order
+        struct PassStats {
+            const char* name;
+            UpdatePhase phase;
+            size_t      count;  // instances updated
+            double      ms;
+            bool        parallel; // ran on the worker pool
+        };
+
+        // Called by Entity::addComponent the first time a type is used
+        template <typename T>
+        void registerType() {
+            const ComponentTypeId id = componentTypeId<T>();
+            if (id < known_.size() && known_[id]) return;
+            if (id >= known_.size()) { known_.resize(id + 1, false); passOf_.resize(id + 1, kNoPass); }
+            known_[id] = true;
+
+            // onUpdate only names Component::onUpdate when T didn't override it
+            if (std::is_same<decltype(&T::onUpdate), void (Component::*)(float)>::value) return;
+            addPass(id, T::kUpdatePhase, T::kThreadAccess, typeid(T).name(), &runPass<T>);
+        }
+
+        void schedule(Component* c);
+        void unschedule(Component* c);
+
+        // Runs every pass in phase order
+        void update(float dt);
+
+        // Split OwnerOnly passes across the WorkerPool (off by default)
+        void setParallel(bool on) { parallel_ = on; }
+        bool parallel() const { return parallel_; }
+
+        const std::vector<PassStats>& stats() const { return stats_; }
+
+    private:
+        SystemRegistry() = default;
+        SystemRegistry(const SystemRegistry&) = delete;
+        SystemRegistry& operator=(const SystemRegistry&) = delete;
+
+        static constexpr uint32_t kNoPass = 0xFFFFFFFFu;
+
+        // Runs items [begin, end); end is clamped to the live size, so a serial pass can pass
+        // SIZE_MAX and also pick up components added while it runs
+        using PassFn = void (*)(std::vector<Component*>& items, size_t begin, size_t end, float dt);
+
+        // OwnerOnly passes smaller than this aren't worth waking the workers for
+        static constexpr size_t kParallelChunk = 64;
+
+        struct Pass {
+            ComponentTypeId id;
+            UpdatePhase     phase;
+            ThreadAccess    access;
+            const char*     name;
+            PassFn          run;
+            std::vector<Component*> items;  // removal during update leaves nullptr, compacted after
+            bool            dirty = false;
+        };
+
+        // Items are exactly T (addComponent<T> creates T), so the qualified call skips the vtable
+        template <typename T>
+        static void runPass(std::vector<Component*>& items, size_t begin, size_t end, float dt) {
+            for (size_t i = begin; i < end && i < items.size(); ++i) {
+                if (Component* c = items[i]) static_cast<T*>(c)->T::onUpdate(dt);
+            }
+        }
+
+        void addPass(ComponentTypeId id, UpdatePhase phase, ThreadAccess access, const char* name, PassFn run);
+        void compact(Pass& pass);
+
+        std::deque<Pass>      passes_;   // registration order (deque: stable while a pass runs)
+        std::vector<uint32_t> order_;    // indices into passes_, sorted by phase
+        std::vector<uint32_t> passOf_;   // type id -> index in passes_
+        std::vector<bool>     known_;    // type id -> registered
+        std::vector<PassStats> stats_;
+        bool updating_ = false;
+        bool parallel_ = false;
+        bool orderDirty_ = false;  // a type registered during update(); re-sort afterwards
+    };
+
+} // namespace ecs
@@ -1,13 +1,71 @@
 // ecs/Tag.h
 #pragma once
+#include <cstdint>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 
 namespace ecs {
+    // Tags are interned: every distinct tag string maps to a small integer id,
+    // so tag checks are an integer compare and EntityManager can keep a list per tag.
+    using TagId = uint16_t;
+    constexpr TagId kNoTag = 0; // id of the empty tag
+
+    namespace detail {
+        struct TagTable {
+            std::mutex mutex;
+            std::deque<std::string> names{ std::string() }; // index = id (deque: stable references)
+            std::unordered_map<std::string_view, TagId> ids{ { std::string_view(), kNoTag } };
+        };
+        inline TagTable& tagTable() {
+            static TagTable table;
+            return table;
+        }
+    }
+
+    // Id for s, registering it on first use
+    inline TagId internTag(std::string_view s) {
+        auto& t = detail::tagTable();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        auto it = t.ids.find(s);
+        if (it != t.ids.end()) return it->second;
+        const TagId id = static_cast<TagId>(t.names.size());
+        t.names.emplace_back(s);
+        t.ids.emplace(std::string_view(t.names.back()), id);
+        return id;
+    }
+
+    // Id for s if it was ever interned, kNoTag otherwise (doesn't grow the table)
+    inline TagId findTag(std::string_view s) {
+        auto& t = detail::tagTable();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        auto it = t.ids.find(s);
+        return (it != t.ids.end()) ? it->second : kNoTag;
+    }
+
+    inline const std::string& tagName(TagId id) {
+        auto& t = detail::tagTable();
+        std::lock_guard<std::mutex> lock(t.mutex);
+        return (id < t.names.size()) ? t.names[id] : t.names[kNoTag];
+    }
+
     struct Tag {
         std::string value;
+        TagId id = kNoTag;
         Tag() = default;
-        explicit Tag(const std::string& v) : value(v) {}
-        bool is(const std::string& s) const { return value == s; }
-        bool empty() const { return value.empty(); }
+        explicit Tag(const std::string& v) : value(v), id(internTag(v)) {}
+        bool is(TagId t) const { return id == t; }
+        bool is(const std::string& s) const { return s.empty() ? id == kNoTag : (id != kNoTag && id == findTag(s)); }
+        bool empty() const { return id == kNoTag; }
     };
 } // namespace ecs
+
+// Tags the engine and game look up by id
+inline const ecs::TagId TAG_PLAYER = ecs::internTag("PLAYER");
+inline const ecs::TagId TAG_GROUND = ecs::internTag("GROUND");
+inline const ecs::TagId TAG_PLATFORM = ecs::internTag("PLATFORM");
+inline const ecs::TagId TAG_MOVING_PLATFORM = ecs::internTag("MOVING_PLATFORM");
+inline const ecs::TagId TAG_SPAWN = ecs::internTag("SPAWN");
+inline const ecs::TagId TAG_DEATH = ecs::internTag("DEATH");
@@ -1,4 +1,32 @@
 #include "Entity.h"
+#include "EntityManager.h"
+#include <algorithm>
+
+void Entity::setTag(const std::string& t) {
+    const ecs::TagId old = tag.id;
+    tag = ecs::Tag(t);
+    type = t;
+    if (tag.id != old) {
+        EntityManager::getInstance().onTagChanged(this);
+    }
+}
+
+void Entity::onComponentAdded(ComponentMask oldMask) {
+    if (!handle.isNull()) {
+        EntityManager::getInstance().onComponentsChanged(this, oldMask);
+    }
+}
+
+void Entity::insertByType(unsigned at, ecs::Component* c) {
+    const unsigned count = popCount(componentMask);
+    if (count == kInlineComponents && !byTypeHeap) {
+        byTypeHeap = std::make_unique<ecs::Component*[]>(kMaxComponentTypes);
+        std::copy(byTypeInline, byTypeInline + count, byTypeHeap.get());
+    }
+    ecs::Component** list = byTypeHeap ? byTypeHeap.get() : byTypeInline;
+    std::copy_backward(list + at, list + count, list + count + 1);
+    list[at] = c;
+}
 
 // AABB overlap test using floats, avoids SDL rect API differences
 bool collisionDetection(Entity& a, Entity& b) {
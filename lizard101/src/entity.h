@@ -1,39 +1,55 @@
 // Entity.h
 #pragma once
 #include <SDL3/SDL.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
-#include <unordered_map>
 
 #include "ecs/Component.h"
 #include "ecs/ComponentType.h"
+#include "ecs/SystemRegistry.h"
 #include "ecs/Tag.h"
+#include "EntityHandle.h"
+#include "BodyStore.h"
+#include "ObjectPool.h"
+
+// Draw order bucket. EntityManager::renderAll draws layers bottom to top; inside a layer
+// entities keep the order they were added in.
+enum class RenderLayer : uint8_t {
+    Background = 0,
+    World,
+    Actors,
+    Overlays,
+    Hand,
+    UI,
+    Count
+};
+constexpr size_t kRenderLayerCount = static_cast<size_t>(RenderLayer::Count);
 
 struct Entity {
-    // identity & transform
+    // identity (rename managed entities through EntityManager::renameEntity)
     std::string name;
     std::string type;
-    float x = 0.0f;
-    float y = 0.0f;
-    int   width = 32;
-    int   height = 32;
-
-    // physics flags
-    bool  physicsEnabled = false;
-    float velY = 0.0f;
+
+    // position, size and velocity live in the BodyStore, see the accessors below
     bool  isSolid = false;
 
     // tag (mirrors type)
     ecs::Tag tag;
 
+    // draw order; set before adding to the manager, afterwards use EntityManager::setRenderLayer
+    RenderLayer renderLayer = RenderLayer::World;
+
+    // assigned by EntityManager::addEntity (null while the entity is not managed)
+    EntityHandle handle;
+
     // Primary ctor
     Entity(std::string name, float posX, float posY, int w, int h,
         bool physicsEnabled = false, bool isSolid = false,
         std::string entType = "GENERIC")
-        : name(std::move(name)), type(std::move(entType)),
-        x(posX), y(posY), width(w), height(h),
-        physicsEnabled(physicsEnabled), isSolid(isSolid) {
+        : name(std::move(name)), type(std::move(entType)), isSolid(isSolid),
+        body_(BodyStore::getInstance().allocate(posX, posY, w, h, physicsEnabled)) {
     }
 
     // COMPAT ctor to keep existing code compiling (ignores 'tex')
@@ -43,64 +59,142 @@ struct Entity {
         : Entity(std::move(name), posX, posY, w, h, physicsEnabled, isSolid, std::move(entType)) {
     }
 
-    virtual ~Entity() = default;
+    virtual ~Entity() { BodyStore::getInstance().release(body_); }
 
+    // Entity-level logic. Components are not updated from here: SystemRegistry runs one pass
+    // per component type after EntityManager has updated every entity.
     virtual void update(float deltaTime) {
         (void)deltaTime;
-        updateComponents(deltaTime);
     }
 
+    // OwnerOnly lets a parallel updateAll run update() on a worker thread; only return it if
+    // update() touches nothing but this entity
+    virtual ecs::ThreadAccess updateAccess() const { return ecs::ThreadAccess::MainThread; }
+
     // tags
-    void setTag(const std::string& t) { tag = ecs::Tag(t); type = t; }
+    // setTag keeps EntityManager's per-tag lists in sync (entity.cpp)
+    void setTag(const std::string& t);
     const ecs::Tag& getTag() const { return tag; }
+    bool hasTag(ecs::TagId t) const { return tag.id == t; }
     bool hasTag(const std::string& t) const { return tag.is(t); }
 
     // component management
     template <typename T, typename... Args>
     T& addComponent(Args&&... args) {
-        const ComponentTypeId tid = componentTypeId<T>();
-        auto it = compIndex.find(tid);
-        if (it != compIndex.end()) return *static_cast<T*>(it->second);
-
-        std::unique_ptr<T> ptr(new T(std::forward<Args>(args)...));
-        T* raw = ptr.get();
-        raw->attachOwner(this);
-        components.emplace_back(std::move(ptr));
-        compIndex[tid] = raw;
+        if (T* existing = getComponent<T>()) return *existing;
+
+        // Components come from a per-type pool; the deleter hands them back on destruction
+        T* raw = ObjectPool<T>::instance().create(std::forward<Args>(args)...);
+        components.emplace_back(raw, &releaseComponent<T>);
+        raw->attachOwner(this, componentTypeId<T>());
+        const ComponentMask bit = componentBit<T>();
+        const ComponentMask oldMask = componentMask;
+        insertByType(popCount(componentMask & (bit - 1)), raw);
+        componentMask |= bit;
+        ecs::SystemRegistry::getInstance().registerType<T>();
+        if (!handle.isNull()) ecs::SystemRegistry::getInstance().schedule(raw);
+        onComponentAdded(oldMask);
         raw->onStart();
         return *raw;
     }
 
     template <typename T>
     T* getComponent() const {
-        const ComponentTypeId tid = componentTypeId<T>();
-        auto it = compIndex.find(tid);
-        if (it == compIndex.end()) return nullptr;
-        return static_cast<T*>(it->second);
+        // byType is ordered by type id, so T's slot is the number of set bits below its own
+        const ComponentMask bit = componentBit<T>();
+        if (!(componentMask & bit)) return nullptr;
+        return static_cast<T*>(byType()[popCount(componentMask & (bit - 1))]);
     }
 
-    void updateComponents(float dt) {
-        for (auto& c : components) c->onUpdate(dt);
+    // True if the entity has every listed component (one mask test)
+    template <typename... Ts>
+    bool hasComponents() const {
+        const ComponentMask want = ::componentMask<Ts...>();
+        return (componentMask & want) == want;
+    }
+
+    ComponentMask getComponentMask() const { return componentMask; }
+
+    // Add/remove this entity's components from the SystemRegistry passes (EntityManager does
+    // this when the entity is added or removed)
+    void scheduleComponents() {
+        for (auto& c : components) ecs::SystemRegistry::getInstance().schedule(c.get());
+    }
+    void unscheduleComponents() {
+        for (auto& c : components) ecs::SystemRegistry::getInstance().unschedule(c.get());
     }
 
     void renderComponents(SDL_Renderer* renderer) {
         for (auto& c : components) c->onRender(renderer);
     }
 
-    // for components
-    float getX() const { return x; }
-    float getY() const { return y; }
-    int   getWidth() const { return width; }
-    int   getHeight() const { return height; }
+    // transform / body (forwarded to this entity's BodyStore row)
+    float getX() const { return BodyStore::getInstance().x[body_]; }
+    float getY() const { return BodyStore::getInstance().y[body_]; }
+    int   getWidth() const { return BodyStore::getInstance().width[body_]; }
+    int   getHeight() const { return BodyStore::getInstance().height[body_]; }
+    float getVelY() const { return BodyStore::getInstance().velY[body_]; }
+    bool  isPhysicsEnabled() const { return BodyStore::getInstance().physics[body_] != 0; }
+
+    // Rect setters also queue the row for the BodyStore grid (render culling)
+    void setX(float v) { BodyStore::getInstance().setX(body_, v); }
+    void setY(float v) { BodyStore::getInstance().setY(body_, v); }
+    void setPosition(float px, float py) { setX(px); setY(py); }
+    void moveBy(float dx, float dy) { setPosition(getX() + dx, getY() + dy); }
+    void setWidth(int w) { BodyStore::getInstance().setWidth(body_, w); }
+    void setHeight(int h) { BodyStore::getInstance().setHeight(body_, h); }
+    void setVelY(float v) { BodyStore::getInstance().velY[body_] = v; }
+    void setPhysicsEnabled(bool on) { BodyStore::getInstance().physics[body_] = on ? 1 : 0; }
+
+    uint32_t body() const { return body_; }
 
 private:
-    std::vector<std::unique_ptr<ecs::Component>> components;
-    std::unordered_map<ComponentTypeId, ecs::Component*> compIndex;
+    // Lets EntityManager update its cached views (entity.cpp)
+    void onComponentAdded(ComponentMask oldMask);
+
+    uint32_t body_; // row in BodyStore, owned for the entity's lifetime
+
+    using ComponentPtr = std::unique_ptr<ecs::Component, void (*)(ecs::Component*)>;
+
+    template <typename T>
+    static void releaseComponent(ecs::Component* c) {
+        ecs::SystemRegistry::getInstance().unschedule(c);
+        ObjectPool<T>::instance().destroy(static_cast<T*>(c));
+    }
+
+    std::vector<ComponentPtr> components;
+    ComponentMask componentMask = 0;      // one bit per component type present
+
+    // Non-owning component pointers sorted by type id. The game's entities carry a few
+    // components, which fit inline (no allocation, no extra hop in getComponent); the fifth
+    // moves the list to a heap block sized for every type.
+    static constexpr size_t kInlineComponents = 4;
+    ecs::Component* byTypeInline[kInlineComponents] = {};
+    std::unique_ptr<ecs::Component*[]> byTypeHeap;
+
+    ecs::Component* const* byType() const { return byTypeHeap ? byTypeHeap.get() : byTypeInline; }
+    void insertByType(unsigned at, ecs::Component* c); // entity.cpp
 };
 
+// Pooled entities: allocate with newPooled and add with pooledDeleter() (same T), so
+// removing the entity hands its memory back to ObjectPool<T> instead of the heap
+template <typename T = Entity, typename... Args>
+T* newPooled(Args&&... args) {
+    return ObjectPool<T>::instance().create(std::forward<Args>(args)...);
+}
+
+template <typename T = Entity>
+EntityDeleter pooledDeleter() {
+    return EntityDeleter{
+        [](void* ctx, Entity* e) { static_cast<ObjectPool<T>*>(ctx)->destroy(static_cast<T*>(e)); },
+        &ObjectPool<T>::instance() };
+}
+
 // helpers
 inline SDL_FRect getBounds(const Entity& e) {
-    return SDL_FRect{ e.x, e.y, static_cast<float>(e.width), static_cast<float>(e.height) };
+    const BodyStore& b = BodyStore::getInstance();
+    const uint32_t i = e.body();
+    return SDL_FRect{ b.x[i], b.y[i], static_cast<float>(b.width[i]), static_cast<float>(b.height[i]) };
 }
 
 // collision helper (decl only, impl in entity.cpp)
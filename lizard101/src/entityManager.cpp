@@ -1,5 +1,8 @@
 #include "EntityManager.h"
 #include "Entity.h"
+#include "SpriteBatch.h"
+#include "JobSystem.hpp"
+#include "game/Camera.h"
 #include <algorithm>
 
 EntityManager& EntityManager::getInstance() {
@@ -15,78 +18,443 @@ void EntityManager::defaultDelete(void* /*ctx*/, Entity* e) {
     delete e;
 }
 
-void EntityManager::refreshEntityView() {
-    entities.clear();
-    entities.reserve(entries_.size());
-    for (auto& entry : entries_) {
-        entities.push_back(entry.ptr);
+// ----------------- Slot map -----------------
+
+EntityHandle EntityManager::insert(Entity* entity, Deleter deleter, bool front) {
+    if (!entity) return EntityHandle{};
+
+    uint32_t index;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    }
+    else {
+        index = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+
+    Slot& slot = slots_[index];
+    slot.ptr = entity;
+    slot.deleter = deleter;
+    slot.dense = static_cast<uint32_t>(entities.size());
+    entities.push_back(entity);
+    denseSlots_.push_back(index);
+
+    entity->handle = EntityHandle{ index, slot.generation };
+    if (entity->body() >= byBody_.size()) byBody_.resize(entity->body() + 1, nullptr);
+    byBody_[entity->body()] = entity;
+    BodyStore::getInstance().setManaged(entity->body(), true);
+    entity->scheduleComponents();
+    placeInBucket(slot, entity, front);
+    indexName(slot, entity);
+    indexTag(slot, entity);
+    addToViews(entity);
+    return entity->handle;
+}
+
+Entity* EntityManager::get(EntityHandle handle) const {
+    if (handle.index >= slots_.size()) return nullptr;
+    const Slot& slot = slots_[handle.index];
+    return (slot.generation == handle.generation) ? slot.ptr : nullptr;
+}
+
+void EntityManager::removeEntity(Entity* entity) {
+    if (entity && get(entity->handle) == entity) {
+        removeEntity(entity->handle);
+    }
+}
+
+void EntityManager::removeEntity(EntityHandle handle) {
+    Entity* entity = get(handle);
+    if (!entity) return;
+    if (updating_) {
+        // Swap-removing now would move an entity the loop hasn't reached into a visited slot
+        commands_.destroy(handle);
+        return;
+    }
+
+    Slot& slot = slots_[handle.index];
+    removeFromBucket(slot);
+    unindexName(slot, entity);
+    removeFromViews(entity, entity->getComponentMask(), slot.tag);
+    unindexTag(slot);
+
+    // Swap the last dense entry into the hole
+    const uint32_t hole = slot.dense;
+    const uint32_t last = static_cast<uint32_t>(entities.size()) - 1;
+    if (hole != last) {
+        entities[hole] = entities[last];
+        denseSlots_[hole] = denseSlots_[last];
+        slots_[denseSlots_[hole]].dense = hole;
+    }
+    entities.pop_back();
+    denseSlots_.pop_back();
+
+    const Deleter deleter = slot.deleter;
+    slot.ptr = nullptr;
+    slot.deleter = Deleter{ nullptr, nullptr };
+    slot.generation++;
+    freeSlots_.push_back(handle.index);
+
+    entity->handle = EntityHandle{};
+    byBody_[entity->body()] = nullptr;
+    BodyStore::getInstance().setManaged(entity->body(), false);
+    entity->unscheduleComponents();
+    if (deleter.fn) {
+        deleter.fn(deleter.ctx, entity);
     }
 }
 
 void EntityManager::destroyAll() {
-    for (auto& entry : entries_) {
-        if (entry.ptr && entry.deleter.fn) {
-            entry.deleter.fn(entry.deleter.ctx, entry.ptr);
+    commands_.clear(); // pending creates are freed, nothing queued outlives the world
+    // Slots (and their generations) are kept so handles from before stay stale
+    for (uint32_t index : denseSlots_) {
+        Slot& slot = slots_[index];
+        Entity* e = slot.ptr;
+        const Deleter deleter = slot.deleter;
+        slot.ptr = nullptr;
+        slot.deleter = Deleter{ nullptr, nullptr };
+        slot.nameKey = std::string_view();
+        slot.tag = ecs::kNoTag;
+        slot.generation++;
+        freeSlots_.push_back(index);
+        if (e) {
+            byBody_[e->body()] = nullptr;
+            BodyStore::getInstance().setManaged(e->body(), false);
+            e->unscheduleComponents();
+        }
+        if (e && deleter.fn) {
+            deleter.fn(deleter.ctx, e);
         }
     }
-    entries_.clear();
     entities.clear();
+    denseSlots_.clear();
+    for (auto& bucket : renderBuckets_) bucket.clear();
+    bucketDirty_.fill(false);
+    byName_.clear();
+    for (auto& list : byTag_) list.clear();
+    for (auto& view : views_) view->entities.clear();
+}
+
+// ----------------- Command buffers -----------------
+
+void EntityManager::playback(EntityCommandBuffer& buffer) {
+    if (buffer.empty() || playingBack_) return;
+    using Op = EntityCommandBuffer::Op;
+
+    // Swap the commands out so anything recorded during playback lands in the (empty) buffer;
+    // the two vectors ping-pong, so neither reallocates once warmed up
+    playbackScratch_.swap(buffer.commands_);
+    const size_t creates = buffer.creates_;
+    buffer.creates_ = 0;
+    playingBack_ = true;
+
+    entities.reserve(entities.size() + creates);
+    denseSlots_.reserve(denseSlots_.size() + creates);
+
+    for (auto& cmd : playbackScratch_) {
+        switch (cmd.op) {
+        case Op::Create:
+        case Op::CreateInFront:
+            if (cmd.entity) insert(cmd.entity, cmd.deleter, cmd.op == Op::CreateInFront);
+            break;
+        case Op::Destroy:
+            removeEntity(cmd.handle);
+            break;
+        case Op::Apply: {
+            Entity* e = cmd.entity ? cmd.entity : get(cmd.handle);
+            if (e) cmd.fn(*e);
+            break;
+        }
+        }
+    }
+
+    playbackScratch_.clear();
+    playingBack_ = false;
 }
 
-void EntityManager::addEntity(Entity* entity) {
-    addEntity(entity, Deleter{ &EntityManager::defaultDelete, nullptr });
+// ----------------- Name index -----------------
+
+void EntityManager::indexName(Slot& slot, Entity* entity) {
+    auto it = byName_.find(entity->name);
+    if (it == byName_.end()) {
+        NameBucket bucket;
+        bucket.key = std::make_unique<std::string>(entity->name);
+        const std::string_view key = *bucket.key;
+        it = byName_.emplace(key, std::move(bucket)).first;
+    }
+    it->second.entities.push_back(entity);
+    slot.nameKey = it->first;
 }
 
-void EntityManager::addEntity(Entity* entity, Deleter deleter) {
-    entries_.push_back(Entry{ entity, deleter });
-    refreshEntityView();
+void EntityManager::unindexName(Slot& slot, Entity* entity) {
+    // Slot remembers the key, so this works even if Entity::name was assigned directly
+    auto it = byName_.find(slot.nameKey);
+    slot.nameKey = std::string_view();
+    if (it == byName_.end()) return;
+    auto& list = it->second.entities;
+    list.erase(std::remove(list.begin(), list.end(), entity), list.end());
+    if (list.empty()) byName_.erase(it);
 }
 
-void EntityManager::addEntityToFront(Entity* entity) {
-    addEntityToFront(entity, Deleter{ &EntityManager::defaultDelete, nullptr });
+// ----------------- Tag index -----------------
+
+void EntityManager::indexTag(Slot& slot, Entity* entity) {
+    slot.tag = entity->tag.id;
+    if (slot.tag == ecs::kNoTag) return;
+    if (slot.tag >= byTag_.size()) byTag_.resize(slot.tag + 1);
+    auto& list = byTag_[slot.tag];
+    slot.tagPos = static_cast<uint32_t>(list.size());
+    list.push_back(entity);
 }
 
-void EntityManager::addEntityToFront(Entity* entity, Deleter deleter) {
-    entries_.insert(entries_.begin(), Entry{ entity, deleter });
-    refreshEntityView();
+void EntityManager::unindexTag(Slot& slot) {
+    if (slot.tag == ecs::kNoTag) return;
+    // Swap-remove: tag lists are unordered
+    auto& list = byTag_[slot.tag];
+    Entity* moved = list.back();
+    list[slot.tagPos] = moved;
+    slots_[moved->handle.index].tagPos = slot.tagPos;
+    list.pop_back();
+    slot.tag = ecs::kNoTag;
 }
 
-void EntityManager::updateAll(float deltaTime) {
-    for (auto& entry : entries_) {
-        Entity* e = entry.ptr;
-        if (!e) continue;
-        e->update(deltaTime);
-        e->updateComponents(deltaTime);
+void EntityManager::onTagChanged(Entity* entity) {
+    if (!entity || get(entity->handle) != entity) return; // not managed yet, indexed on add
+    Slot& slot = slots_[entity->handle.index];
+    removeFromViews(entity, entity->getComponentMask(), slot.tag);
+    unindexTag(slot);
+    indexTag(slot, entity);
+    addToViews(entity);
+}
+
+const std::vector<Entity*>& EntityManager::withTag(ecs::TagId tag) const {
+    static const std::vector<Entity*> kNone;
+    return (tag != ecs::kNoTag && tag < byTag_.size()) ? byTag_[tag] : kNone;
+}
+
+// ----------------- Views -----------------
+
+const std::vector<Entity*>& EntityManager::viewMask(ComponentMask mask, ecs::TagId tag) {
+    for (const auto& view : views_) {
+        if (view->mask == mask && view->tag == tag) return view->entities;
+    }
+
+    // First use: one scan to fill it, incremental from here on
+    auto view = std::make_unique<View>();
+    view->mask = mask;
+    view->tag = tag;
+    const std::vector<Entity*>& source = (tag != ecs::kNoTag) ? withTag(tag) : entities;
+    for (Entity* e : source) {
+        if (e && view->matches(e->getComponentMask(), e->tag.id)) view->add(e);
     }
+    views_.push_back(std::move(view));
+    return views_.back()->entities;
 }
 
-void EntityManager::renderAll(SDL_Renderer* renderer) {
-    for (auto& entry : entries_) {
-        Entity* e = entry.ptr;
-        if (!e) continue;
-        e->renderComponents(renderer);
+void EntityManager::addToViews(Entity* entity) {
+    const ComponentMask mask = entity->getComponentMask();
+    for (auto& view : views_) {
+        if (view->matches(mask, entity->tag.id)) view->add(entity);
     }
 }
 
-void EntityManager::removeEntity(Entity* entity) {
-    auto it = std::find_if(entries_.begin(), entries_.end(),
-        [entity](const Entry& entry) { return entry.ptr == entity; });
+void EntityManager::removeFromViews(Entity* entity, ComponentMask mask, ecs::TagId tag) {
+    for (auto& view : views_) {
+        if (view->matches(mask, tag)) view->remove(entity);
+    }
+}
 
-    if (it != entries_.end()) {
-        if (it->ptr && it->deleter.fn) {
-            it->deleter.fn(it->deleter.ctx, it->ptr);
+void EntityManager::onComponentsChanged(Entity* entity, ComponentMask oldMask) {
+    if (!entity || get(entity->handle) != entity) return;
+    // Components are only ever added, so only views that didn't match before can gain it
+    const ComponentMask mask = entity->getComponentMask();
+    for (auto& view : views_) {
+        if (!view->matches(oldMask, entity->tag.id) && view->matches(mask, entity->tag.id)) {
+            view->add(entity);
         }
-        entries_.erase(it);
-        refreshEntityView();
     }
 }
 
-Entity* EntityManager::findEntityByName(const std::string& name) {
-    for (auto& entry : entries_) {
-        Entity* e = entry.ptr;
-        if (e && e->name == name) {
-            return e;
+// ----------------- Render buckets -----------------
+
+void EntityManager::placeInBucket(Slot& slot, Entity* entity, bool front) {
+    slot.bucket = static_cast<uint8_t>(entity->renderLayer);
+    auto& bucket = renderBuckets_[slot.bucket];
+    if (front) {
+        bucket.insert(bucket.begin(), entity);
+        renumberBucket(slot.bucket);
+    }
+    else {
+        slot.bucketPos = static_cast<uint32_t>(bucket.size());
+        bucket.push_back(entity);
+    }
+}
+
+void EntityManager::removeFromBucket(Slot& slot) {
+    renderBuckets_[slot.bucket][slot.bucketPos] = nullptr;
+    bucketDirty_[slot.bucket] = true;
+}
+
+void EntityManager::renumberBucket(size_t bucket) {
+    auto& list = renderBuckets_[bucket];
+    for (size_t i = 0; i < list.size(); ++i) {
+        if (list[i]) slots_[list[i]->handle.index].bucketPos = static_cast<uint32_t>(i);
+    }
+}
+
+void EntityManager::compactBuckets() {
+    for (size_t b = 0; b < kRenderLayerCount; ++b) {
+        if (!bucketDirty_[b]) continue;
+        auto& list = renderBuckets_[b];
+        list.erase(std::remove(list.begin(), list.end(), nullptr), list.end());
+        renumberBucket(b);
+        bucketDirty_[b] = false;
+    }
+}
+
+// ----------------- Public API -----------------
+
+EntityHandle EntityManager::addEntity(Entity* entity) {
+    return addEntity(entity, Deleter{ &EntityManager::defaultDelete, nullptr });
+}
+
+EntityHandle EntityManager::addEntity(Entity* entity, Deleter deleter) {
+    return insert(entity, deleter, false);
+}
+
+EntityHandle EntityManager::addEntityToFront(Entity* entity) {
+    return addEntityToFront(entity, Deleter{ &EntityManager::defaultDelete, nullptr });
+}
+
+EntityHandle EntityManager::addEntityToFront(Entity* entity, Deleter deleter) {
+    // Only the entity's own layer shifts; nothing else moves
+    return insert(entity, deleter, true);
+}
+
+void EntityManager::setRenderLayer(Entity* entity, RenderLayer layer) {
+    if (!entity) return;
+    if (get(entity->handle) != entity) {
+        entity->renderLayer = layer; // not managed yet, picked up by addEntity
+        return;
+    }
+    Slot& slot = slots_[entity->handle.index];
+    if (slot.bucket == static_cast<uint8_t>(layer)) return;
+    removeFromBucket(slot);
+    entity->renderLayer = layer;
+    placeInBucket(slot, entity, false);
+}
+
+void EntityManager::updateAll(float deltaTime) {
+    flushCommands();
+    // Entity logic first (index loop: updates may still add entities directly, which appends
+    // to the dense array; removals are deferred), then one pass per component type
+    updating_ = true;
+    if (!parallelUpdate_) {
+        for (size_t i = 0; i < entities.size(); ++i) {
+            Entity* e = entities[i];
+            if (!e) continue;
+            e->update(deltaTime);
+        }
+    }
+    else {
+        // Main-thread entities first, in order; thread-safe ones are batched for the workers
+        parallelScratch_.clear();
+        for (size_t i = 0; i < entities.size(); ++i) {
+            Entity* e = entities[i];
+            if (!e) continue;
+            if (e->updateAccess() == ecs::ThreadAccess::OwnerOnly) parallelScratch_.push_back(e);
+            else e->update(deltaTime);
         }
+        WorkerPool::getInstance().parallelFor(parallelScratch_.size(), kParallelChunk,
+            [this, deltaTime](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) parallelScratch_[i]->update(deltaTime);
+            });
+    }
+    ecs::SystemRegistry::getInstance().update(deltaTime);
+    updating_ = false;
+    flushCommands();
+}
+
+void EntityManager::setParallelUpdate(bool on, unsigned numThreads) {
+    parallelUpdate_ = on;
+    ecs::SystemRegistry::getInstance().setParallel(on);
+    if (on) WorkerPool::getInstance().start(numThreads);
+    else WorkerPool::getInstance().stop();
+}
+
+void EntityManager::renderAll(SDL_Renderer* renderer) {
+    // Cull against what the camera can actually see this frame
+    Camera& camera = Camera::getInstance();
+    int outW = 0, outH = 0;
+    if (SDL_GetCurrentRenderOutputSize(renderer, &outW, &outH)) {
+        camera.setViewportSize(static_cast<float>(outW), static_cast<float>(outH));
+    }
+    renderStats_ = RenderStats{};
+    flushCommands();
+    compactBuckets();
+
+    // Only entities in the BodyStore grid cells under the camera are looked at, so a long
+    // level costs what is on screen. Render components draw inside the entity rect, so that
+    // is the render bound; the grid is coarse, hence the exact test.
+    BodyStore& bodies = BodyStore::getInstance();
+    bodies.syncGrid();
+    const SDL_FRect view = camera.worldView();
+    bodyScratch_.clear();
+    bodies.query(view.x, view.y, view.w, view.h, bodyScratch_);
+    visibleScratch_.clear();
+    for (uint32_t body : bodyScratch_) {
+        Entity* e = body < byBody_.size() ? byBody_[body] : nullptr;
+        if (e && camera.isVisible(getBounds(*e))) visibleScratch_.push_back(e);
     }
-    return nullptr;
+    // Back into draw order: render layer, then position inside the layer's bucket
+    std::sort(visibleScratch_.begin(), visibleScratch_.end(), [this](const Entity* a, const Entity* b) {
+        const Slot& sa = slots_[a->handle.index];
+        const Slot& sb = slots_[b->handle.index];
+        return sa.bucket != sb.bucket ? sa.bucket < sb.bucket : sa.bucketPos < sb.bucketPos;
+        });
+
+    // Components submit into the sprite batch; everything is drawn in a few calls at flush
+    // Each render layer gets its own band of batch layers, so component layers only order
+    // quads inside their entity's render layer
+    SpriteBatch& batch = SpriteBatch::getInstance();
+    batch.begin();
+    for (Entity* e : visibleScratch_) {
+        const int layer = slots_[e->handle.index].bucket;
+        batch.setLayerBase(layer * SpriteBatch::kLayerStride);
+        e->renderComponents(renderer);
+    }
+    batch.flush(renderer);
+    renderStats_.drawn = visibleScratch_.size();
+    renderStats_.culled = entities.size() - visibleScratch_.size();
+}
+
+void EntityManager::renameEntity(Entity* entity, std::string newName) {
+    if (!entity) return;
+    if (get(entity->handle) != entity) {
+        entity->name = std::move(newName);
+        return;
+    }
+    Slot& slot = slots_[entity->handle.index];
+    unindexName(slot, entity);
+    entity->name = std::move(newName);
+    indexName(slot, entity);
+}
+
+Entity* EntityManager::findCached(EntityHandle& cache, std::string_view name) {
+    if (Entity* e = get(cache)) return e;
+    Entity* e = findEntityByName(name);
+    cache = e ? e->handle : EntityHandle{};
+    return e;
+}
+
+Entity* EntityManager::findEntityByName(std::string_view name) const {
+    auto it = byName_.find(name);
+    return (it != byName_.end()) ? it->second.entities.front() : nullptr;
+}
+
+const std::vector<Entity*>& EntityManager::findEntitiesByName(std::string_view name) const {
+    static const std::vector<Entity*> kNone;
+    auto it = byName_.find(name);
+    return (it != byName_.end()) ? it->second.entities : kNone;
 }
@@ -1,52 +1,207 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <memory>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <SDL3/SDL.h>
 
-class Entity;
+#include "Entity.h"
+#include "EntityCommandBuffer.h"
 
+// Owns every entity in a slot map: add, remove and handle lookup are O(1).
+// `entities` is the dense array used for iteration. Removing swaps the last entity into the
+// hole, so update order is not insertion order; draw order comes from the render-layer buckets.
 class EntityManager {
 public:
     static EntityManager& getInstance();
 
-    struct Deleter {
-        void (*fn)(void* ctx, Entity* e);
-        void* ctx;
+    using Deleter = EntityDeleter;
+
+    // Per-frame render culling counters (from the last renderAll)
+    struct RenderStats {
+        size_t drawn = 0;   // entities whose components reached onRender
+        size_t culled = 0;  // entities skipped because they were outside the camera viewport
     };
 
     ~EntityManager();
 
-    void addEntity(Entity* entity);
+    EntityHandle addEntity(Entity* entity);
 
-    void addEntity(Entity* entity, Deleter deleter);
+    EntityHandle addEntity(Entity* entity, Deleter deleter);
 
+    // Inside updateAll the removal is recorded into commands() and happens when the update
+    // ends, so the entity loop and the component passes never skip or revisit an entity
     void removeEntity(Entity* entity);
+    void removeEntity(EntityHandle handle);
+
+    // nullptr if the handle is null or the entity has been removed
+    Entity* get(EntityHandle handle) const;
+    bool    isAlive(EntityHandle handle) const { return get(handle) != nullptr; }
 
     void updateAll(float deltaTime);
+
+    // Opt-in parallel update: entities whose updateAccess() is OwnerOnly and OwnerOnly component
+    // passes are split across the WorkerPool (numThreads 0 = one per core); everything else
+    // still runs serially on the calling thread. Turning it off stops the pool.
+    void setParallelUpdate(bool on, unsigned numThreads = 0);
+    bool parallelUpdate() const { return parallelUpdate_; }
     void renderAll(SDL_Renderer* renderer);
+    const RenderStats& renderStats() const { return renderStats_; }
+
+    // Adds the entity so it draws first within its render layer
+    EntityHandle addEntityToFront(Entity* entity);
+    EntityHandle addEntityToFront(Entity* entity, Deleter deleter);
+
+    // Moves an already added entity to another render layer (drawn last within it)
+    void setRenderLayer(Entity* entity, RenderLayer layer);
+
+    // Hashed lookups. Several entities may share a name ("Card", "ManaSymbol"...);
+    // findEntityByName returns the one added first.
+    Entity* findEntityByName(std::string_view name) const;
+    const std::vector<Entity*>& findEntitiesByName(std::string_view name) const;
+
+    // Renames a managed entity and keeps the name index in sync (don't assign Entity::name directly)
+    void renameEntity(Entity* entity, std::string newName);
+
+    // Every live entity carrying the tag (unordered). O(matches) to iterate.
+    const std::vector<Entity*>& withTag(ecs::TagId tag) const;
+    const std::vector<Entity*>& withTag(std::string_view tag) const { return withTag(ecs::findTag(tag)); }
 
-    void addEntityToFront(Entity* entity);
-    void addEntityToFront(Entity* entity, Deleter deleter);
+    // Called by Entity::setTag to move a managed entity to its new tag list
+    void onTagChanged(Entity* entity);
 
-    Entity* findEntityByName(const std::string& name);
+    // Every live entity that has all of Ts (and, if given, the tag). The list is cached: built
+    // on the first call, then kept up to date on add/remove, addComponent and setTag, so a hot
+    // loop only visits entities that match. Unordered. Adding or removing entities (or
+    // components/tags that change membership) rewrites the list, so don't do either while
+    // iterating it (record into commands() instead), and don't iterate it from another thread
+    // while the owner makes such changes.
+    template <typename... Ts>
+    const std::vector<Entity*>& view(ecs::TagId tag = ecs::kNoTag) {
+        return viewMask(componentMask<Ts...>(), tag);
+    }
+    const std::vector<Entity*>& viewMask(ComponentMask mask, ecs::TagId tag = ecs::kNoTag);
+
+    // Called by Entity::addComponent on a managed entity
+    void onComponentsChanged(Entity* entity, ComponentMask oldMask);
+
+    // Resolves a cached handle; if it went stale, finds the entity by name again and refreshes the cache
+    Entity* findCached(EntityHandle& cache, std::string_view name);
 
     void destroyAll();
 
+    // Deferred structural changes for this frame. Record into it while iterating; it is
+    // played back when updateAll starts and ends and before renderAll draws.
+    EntityCommandBuffer& commands() { return commands_; }
+
+    // Applies a buffer's commands in recorded order, in one batch. Commands recorded while
+    // playing back (e.g. by onStart) stay queued for the next sync point.
+    void playback(EntityCommandBuffer& buffer);
+    void flushCommands() { playback(commands_); }
+
+    // Dense view of every live entity. Read only: add/remove through the manager.
     std::vector<Entity*> entities;
 
 private:
-    EntityManager() = default;
+    // Touch the BodyStore and SystemRegistry first so they outlive the manager (destroyAll in
+    // our destructor still releases body rows and unschedules components)
+    EntityManager() { BodyStore::getInstance(); ecs::SystemRegistry::getInstance(); }
     EntityManager(const EntityManager&) = delete;
     EntityManager& operator=(const EntityManager&) = delete;
 
-    struct Entry {
-        Entity* ptr;
-        Deleter deleter;
+    struct Slot {
+        Entity*  ptr = nullptr;     // nullptr = free
+        Deleter  deleter{ nullptr, nullptr };
+        uint32_t generation = 0;    // bumped every time the slot is freed
+        uint32_t dense = 0;         // position in entities / denseSlots_
+        uint8_t  bucket = 0;        // render bucket the entity sits in
+        uint32_t bucketPos = 0;     // position inside that bucket
+        std::string_view nameKey;   // byName_ key the entity is indexed under
+        ecs::TagId tag = ecs::kNoTag;  // tag list the entity sits in
+        uint32_t   tagPos = 0;          // position inside that list
+    };
+
+    std::vector<Slot>     slots_;
+    std::vector<uint32_t> freeSlots_;
+    std::vector<uint32_t> denseSlots_; // slot index for each entry in entities
+
+    RenderStats renderStats_;
+    std::vector<Entity*>  byBody_;         // managed entity owning each BodyStore row
+    std::vector<uint32_t> bodyScratch_;    // renderAll: rows the grid query returned
+    std::vector<Entity*>  visibleScratch_; // renderAll: on-screen entities in draw order
+
+    bool updating_ = false;       // inside updateAll's entity loop / component passes
+    bool parallelUpdate_ = false;
+    std::vector<Entity*> parallelScratch_; // OwnerOnly entities collected for this frame
+    static constexpr size_t kParallelChunk = 64;
+
+    EntityCommandBuffer commands_;
+    std::vector<EntityCommandBuffer::Command> playbackScratch_; // swapped with the buffer being played back
+    bool playingBack_ = false;
+
+    // Draw order: one bucket per RenderLayer, in insertion order.
+    // Removal leaves a nullptr that is compacted away at the next renderAll.
+    std::array<std::vector<Entity*>, kRenderLayerCount> renderBuckets_;
+    std::array<bool, kRenderLayerCount>                 bucketDirty_{};
+
+    // Name index. Keys view into `key`, which lives on the heap so it never moves while the
+    // map rehashes; a C++17 unordered_map can't look up a std::string key by string_view.
+    struct NameBucket {
+        std::unique_ptr<std::string> key;
+        std::vector<Entity*>         entities; // in insertion order
+    };
+    std::unordered_map<std::string_view, NameBucket> byName_;
+
+    void indexName(Slot& slot, Entity* entity);
+    void unindexName(Slot& slot, Entity* entity);
+
+    // Tag membership, indexed by TagId (untagged entities aren't listed)
+    std::vector<std::vector<Entity*>> byTag_;
+
+    void indexTag(Slot& slot, Entity* entity);
+    void unindexTag(Slot& slot);
+
+    // Cached views (few of them; each holds its matching entities, unordered). pos maps a
+    // slot index to the entity's place in the list, so removal is a swap-remove like tagPos.
+    struct View {
+        ComponentMask mask;
+        ecs::TagId    tag;  // kNoTag = any tag
+        std::vector<Entity*> entities;
+        std::vector<uint32_t> pos; // indexed by slot; meaningful only for listed entities
+
+        bool matches(ComponentMask m, ecs::TagId t) const {
+            return (m & mask) == mask && (tag == ecs::kNoTag || tag == t);
+        }
+        void add(Entity* e) {
+            const uint32_t slot = e->handle.index;
+            if (slot >= pos.size()) pos.resize(slot + 1);
+            pos[slot] = static_cast<uint32_t>(entities.size());
+            entities.push_back(e);
+        }
+        void remove(Entity* e) {
+            const uint32_t slot = e->handle.index;
+            if (slot >= pos.size()) return;
+            const uint32_t at = pos[slot];
+            if (at >= entities.size() || entities[at] != e) return; // not listed
+            Entity* moved = entities.back();
+            entities[at] = moved;
+            pos[moved->handle.index] = at;
+            entities.pop_back();
+        }
     };
+    std::vector<std::unique_ptr<View>> views_; // unique_ptr: returned lists never move
 
-    std::vector<Entry> entries_;
+    void addToViews(Entity* entity);
+    void removeFromViews(Entity* entity, ComponentMask mask, ecs::TagId tag);
 
     static void defaultDelete(void* ctx, Entity* e);
-    void refreshEntityView();
+    EntityHandle insert(Entity* entity, Deleter deleter, bool front);
+    void placeInBucket(Slot& slot, Entity* entity, bool front);
+    void removeFromBucket(Slot& slot);
+    void renumberBucket(size_t bucket);
+    void compactBuckets();
 };
@@ -2,12 +2,11 @@
 #include "EventHandler.h"
 #include <iostream>
 
-class CollisionHandler : public EventHandler {
+class CollisionHandler : public EventHandler<CollisionInfo> {
 public:
-    void onEvent(const Event& e) override {
-        if (e.name == "Collision") {
-            std::cout << "Handle collision\n";
-        }
+    void onEvent(const CollisionInfo& e) override {
+        (void)e;
+        std::cout << "Handle collision\n";
     }
 };
 
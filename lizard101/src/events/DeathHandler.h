@@ -1,49 +1,40 @@
-class DeathHandler : public EventHandler {
+class DeathHandler : public EventHandler<DeathInfo> {
 public:
     DeathHandler(EventManger& ev) : events_(ev) {}
 
-    void onEvent(Event& e) override {
-        if (e.type != EventType::Death) {
+    void onEvent(const DeathInfo& e) override {
+        Entity* victim = e.victim;
+        if ( !victim ) {
             return;
         }
 
-        if (auto* d = std::get_if<DeathInfo>(&e.payload)) {
-            Entity* victim = d->victim;
-            if ( !victim ) {
-                return;
-            }
+        Entity* player = e.victim;
+        Entity* spawn = nullptr;
+        float nearestSpawn = std::numeric_limits<float>::max();
 
-            Entity* player = d->victim;
-            Entity* spawn = nullptr;
-            float nearestSpawn = std::numeric_limits<float>::max();
-
-            for( auto* entities : EntityManager::getInstance().entities ) {
-                if ( !entities ) {
-                    continue;
-                }
-
-                // Check for "SPAWN" tag
-                if ( entities->hasTag("SPAWN") ) {
-                    float dx = (entities->x + entities->width*0.5f) - (victim->x + victim->width*0.5f);
-                    float dy = (entities->y + entities->height*0.5f) - (victim->y + victim->height*0.5f);
-                    float d = std::sqrt( dx*dx + dy*dy );
-
-                    if ( d < nearestSpawn ) { 
-                        nearestSpawn = d; 
-                        spawn = entities; 
-                    }
-                }
+        for( auto* entities : EntityManager::getInstance().withTag(TAG_SPAWN) ) {
+            if ( !entities ) {
+                continue;
             }
 
-            if ( spawn ) {
-                player->x = spawn->x;
-                player->y = spawn->y;
-                player->velY = 0.0f;
-                player->velX = 0.0f;
+            float dx = (entities->getX() + entities->getWidth()*0.5f) - (victim->getX() + victim->getWidth()*0.5f);
+            float dy = (entities->getY() + entities->getHeight()*0.5f) - (victim->getY() + victim->getHeight()*0.5f);
+            float d = std::sqrt( dx*dx + dy*dy );
 
-                Camera::getInstance().smoothTo( spawn->x - 200.0f, spawn->y - 100.0f, 0.4f );
+            if ( d < nearestSpawn ) { 
+                nearestSpawn = d; 
+                spawn = entities; 
             }
         }
+
+        if ( spawn ) {
+            player->setX(spawn->getX());
+            player->setY(spawn->getY());
+            player->setVelY(0.0f);
+            player->velX = 0.0f;
+
+            Camera::getInstance().smoothTo( spawn->getX() - 200.0f, spawn->getY() - 100.0f, 0.4f );
+        }
     }
 
 private:
@@ -1,23 +1,27 @@
 #pragma once
-#include <variant>
-#include <string>
+#include "ecs/Tag.h"
+#include <type_traits>
 
 struct Entity; // forward declaration
 
 // ---- Event taxonomy ----
-enum class EventType { Input, Collision, Death, Spawn };
+// Each payload type below is its own event channel in EventManager
 enum class EventPriority : int { High = 0, Normal = 1, Low = 2 };
 
+// Names carried in payloads share the tag interner: ecs::internTag / ecs::tagName
+using NameId = ecs::TagId;
+constexpr NameId kNoName = ecs::kNoTag;
+
 // ---- Payloads ----
+// Payloads are plain data (names are interned NameIds), so queuing one never allocates
 struct InputAction {
     enum class Kind { None, MoveLeft, MoveRight, Jump, DashLeft, DashRight } action;
     bool pressed; // true on press, false on release
-    std::string playerName;
 };
 
 struct CollisionInfo { Entity* a; Entity* b; };
 struct DeathInfo { Entity* victim; };
-struct SpawnInfo { std::string archetype; float x, y; };
+struct SpawnInfo { NameId archetype; float x, y; };
 
 // Mouse-based drag input (for click-dragging the player, etc.)
 struct DragInfo {
@@ -26,18 +30,9 @@ struct DragInfo {
     float y;
 };
 
-// ---- Event envelope ----
-using EventPayload = std::variant<
-    InputAction,
-    CollisionInfo,
-    DeathInfo,
-    SpawnInfo,
-    DragInfo
->;
-
-struct Event {
-    EventType type;
-    EventPriority priority;
-    float timestamp;     // populated from Timeline in EventManager::raise()
-    EventPayload payload;
-};
+static_assert(std::is_trivially_copyable<InputAction>::value, "event payloads must stay plain data");
+static_assert(std::is_trivially_copyable<CollisionInfo>::value, "event payloads must stay plain data");
+static_assert(std::is_trivially_copyable<DeathInfo>::value, "event payloads must stay plain data");
+static_assert(std::is_trivially_copyable<SpawnInfo>::value, "event payloads must stay plain data");
+static_assert(std::is_trivially_copyable<DragInfo>::value, "event payloads must stay plain data");
+
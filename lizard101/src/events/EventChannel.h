@@ -0,0 +1,238 @@
+#pragma once
+#include "events/Event.h"
+#include "events/EventCoalesce.h"
+#include "events/MpscQueue.h"
+#include "Timeline.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Dispatch order of a queued event; the same across all channels so EventManager can merge them
+struct EventKey {
+    EventPriority priority;
+    float timestamp;     // from Timeline; <= 0 means "stamp when drained"
+    std::uint64_t seq;   // monotonically increasing tie-breaker
+};
+
+// True if a goes out before b
+inline bool dispatchesBefore(const EventKey& a, const EventKey& b) {
+    // lower priority enum value = higher priority
+    if (a.priority != b.priority) {
+        return static_cast<int>(a.priority) < static_cast<int>(b.priority);
+    }
+    // older timestamp first
+    if (a.timestamp != b.timestamp) {
+        return a.timestamp < b.timestamp;
+    }
+    // finally FIFO among identical priority/timestamp
+    return a.seq < b.seq;
+}
+
+// What EventManager::dispatch() needs from a channel without knowing its payload type
+class EventChannelBase {
+public:
+    using ListenerId = std::uint64_t;
+
+    virtual ~EventChannelBase() = default;
+
+    // Moves everything pushed so far into the heap (owning thread only)
+    virtual void drain(const Timeline& timeline) = 0;
+    // Key of the next event, or nullptr when nothing is queued
+    virtual const EventKey* top() const = 0;
+    // Pops the next event and hands it to every listener
+    virtual void deliverTop() = 0;
+    // End of dispatch(): forget this frame's coalescing keys
+    virtual void endFrame() = 0;
+};
+
+// Queue and listeners for one payload type. push() is thread safe (lock-free inbox);
+// everything else runs on the thread that owns the EventManager.
+// Repeated events are folded together per EventCoalesce<T> as they enter the queue.
+template <typename T>
+class EventChannel final : public EventChannelBase {
+public:
+    using Listener = std::function<void(const T&)>;
+
+    // Any thread; queued on the next drain()
+    void push(T payload, const EventKey& key, FrameArena* arena) {
+        inbox_.push(Item{ std::move(payload), key }, arena);
+    }
+
+    // Owning thread only: straight into the queue, no inbox round trip
+    void enqueue(T payload, const EventKey& key) {
+        using Policy = EventCoalesce<T>;
+        if constexpr (Policy::kPolicy == CoalescePolicy::None) {
+            queue(std::move(payload), key, nullptr);
+        }
+        else {
+            CoalesceKey ck{};
+            if (!Policy::key(payload, ck)) {
+                keyed_.clear(); // barrier for LatestWins/Merge
+                queue(std::move(payload), key, nullptr);
+                return;
+            }
+            if constexpr (Policy::kPolicy == CoalescePolicy::OncePerFrame) {
+                if (keyed_.find(ck)) return;
+                keyed_.set(ck, 0);
+                queue(std::move(payload), key, &ck);
+            }
+            else {
+                const std::uint32_t* s = keyed_.find(ck);
+                if (s && slots_[*s].live && slots_[*s].keyed && slots_[*s].coalesceKey == ck) {
+                    if constexpr (Policy::kPolicy == CoalescePolicy::LatestWins) {
+                        slots_[*s].payload = std::move(payload);
+                    }
+                    else {
+                        Policy::merge(slots_[*s].payload, payload);
+                    }
+                    return; // keeps the queued event's place in line
+                }
+                keyed_.set(ck, queue(std::move(payload), key, &ck));
+            }
+        }
+    }
+
+    ListenerId subscribe(ListenerId id, Listener cb) {
+        if (dispatching_) pending_.push_back(Entry{ id, std::move(cb), true });
+        else entries_.push_back(Entry{ id, std::move(cb), true });
+        return id;
+    }
+
+    void unsubscribe(ListenerId id) {
+        auto byId = [id](const Entry& l) { return l.id == id; };
+
+        auto p = std::find_if(pending_.begin(), pending_.end(), byId);
+        if (p != pending_.end()) {
+            pending_.erase(p);
+            return;
+        }
+        auto it = std::find_if(entries_.begin(), entries_.end(), byId);
+        if (it == entries_.end()) return;
+        if (dispatching_) {
+            it->alive = false; // the std::function may be running right now; freed in applyDeferred
+            dirty_ = true;
+        }
+        else {
+            entries_.erase(it);
+        }
+    }
+
+    void drain(const Timeline& timeline) override {
+        Item item;
+        while (inbox_.tryPop(item)) {
+            if (item.key.timestamp <= 0.0f) {
+                item.key.timestamp = timeline.getElapsedTime();
+            }
+            enqueue(std::move(item.payload), item.key);
+        }
+    }
+
+    const EventKey* top() const override {
+        return queue_.empty() ? nullptr : &queue_.front().key;
+    }
+
+    void deliverTop() override {
+        std::pop_heap(queue_.begin(), queue_.end(), Later{});
+        const std::uint32_t s = queue_.back().slot;
+        queue_.pop_back();
+
+        // Moved out: listeners may raise into this channel and grow slots_
+        const T payload = std::move(slots_[s].payload);
+        slots_[s].live = false;
+        freeSlots_.push_back(s);
+
+        // Index loop: listeners subscribed meanwhile sit in pending_, so entries_ can't grow
+        dispatching_ = true;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            Entry& l = entries_[i];
+            if (l.alive) l.fn(payload);
+        }
+        dispatching_ = false;
+
+        // Subscribes/unsubscribes made while delivering take effect from the next event
+        applyDeferred();
+    }
+
+    void endFrame() override {
+        keyed_.clear();
+    }
+
+private:
+    using CoalesceKey = typename EventCoalesce<T>::Key;
+
+    struct Item {
+        T payload;
+        EventKey key;
+    };
+
+    // Payloads sit in slots_ so coalescing can update a queued one in place;
+    // the heap only shuffles {key, slot}
+    struct Slot {
+        T             payload;
+        CoalesceKey   coalesceKey; // meaningful only if keyed
+        bool          keyed;
+        bool          live;
+    };
+    struct Queued {
+        EventKey      key;
+        std::uint32_t slot;
+    };
+
+    // std heap functions keep the largest on top, so "larger" means dispatched first
+    struct Later {
+        bool operator()(const Queued& a, const Queued& b) const {
+            return dispatchesBefore(b.key, a.key);
+        }
+    };
+
+    // Returns the slot the payload went into; coalesceKey is nullptr for an event without one
+    std::uint32_t queue(T payload, const EventKey& key, const CoalesceKey* coalesceKey) {
+        Slot slot{ std::move(payload), coalesceKey ? *coalesceKey : CoalesceKey{}, coalesceKey != nullptr, true };
+        std::uint32_t s;
+        if (!freeSlots_.empty()) {
+            s = freeSlots_.back();
+            freeSlots_.pop_back();
+            slots_[s] = std::move(slot);
+        }
+        else {
+            s = static_cast<std::uint32_t>(slots_.size());
+            slots_.push_back(std::move(slot));
+        }
+        queue_.push_back(Queued{ key, s });
+        std::push_heap(queue_.begin(), queue_.end(), Later{});
+        return s;
+    }
+
+    // Listeners live in a dense array that delivery walks in place. While delivering,
+    // unsubscribe only tombstones an entry and subscribe goes to pending_, so nothing
+    // moves under the loop (a listener may unsubscribe itself) and nothing is copied.
+    struct Entry {
+        ListenerId id;
+        Listener   fn;
+        bool       alive;
+    };
+
+    void applyDeferred() {
+        if (dirty_) {
+            entries_.erase(std::remove_if(entries_.begin(), entries_.end(),
+                [](const Entry& l) { return !l.alive; }), entries_.end());
+            dirty_ = false;
+        }
+        if (!pending_.empty()) {
+            for (auto& l : pending_) entries_.push_back(std::move(l));
+            pending_.clear();
+        }
+    }
+
+    MpscQueue<Item>    inbox_;   // any thread -> owner
+    std::vector<Queued> queue_;  // binary heap ordered by Later
+    std::vector<Slot>  slots_;
+    std::vector<std::uint32_t> freeSlots_;
+    CoalesceTable<EventCoalesce<T>> keyed_;   // coalescing key -> slot (LatestWins/Merge) or seen (OncePerFrame)
+    std::vector<Entry> entries_;
+    std::vector<Entry> pending_; // subscribed during delivery
+    bool dispatching_ = false;
+    bool dirty_ = false;         // entries_ has tombstones
+};
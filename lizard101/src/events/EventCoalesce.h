@@ -0,0 +1,128 @@
+#pragma once
+#include "events/Event.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// How an EventChannel folds repeated events together when they are raised
+enum class CoalescePolicy {
+    None,         // every raise is queued
+    LatestWins,   // a queued event with the same key takes the new payload
+    OncePerFrame, // same key again before the frame's dispatch() ends is dropped
+    Merge,        // EventCoalesce<T>::merge folds the new payload into the queued one (counters)
+};
+
+// Per-payload policy. Specializations provide kPolicy, a Key type (plain data with ==) and
+//   static bool key(const T& e, Key& out);  // false: never coalesce this one
+//   static std::uint64_t hash(const Key& k);
+// plus, for Merge, static void merge(T& queued, const T& incoming).
+// Keys are compared exactly; the hash only picks the bucket.
+// For LatestWins/Merge an event that has no key is a barrier: nothing raised after it
+// folds into something queued before it.
+template <typename T>
+struct EventCoalesce {
+    static constexpr CoalescePolicy kPolicy = CoalescePolicy::None;
+    using Key = std::uint64_t; // unused
+};
+
+// Only the latest cursor position matters between a Start and an End
+template <>
+struct EventCoalesce<DragInfo> {
+    static constexpr CoalescePolicy kPolicy = CoalescePolicy::LatestWins;
+    using Key = std::uint64_t;
+    static constexpr Key kMoveKey = 1; // all Moves share one key
+    static bool key(const DragInfo& e, Key& out) {
+        out = kMoveKey;
+        return e.phase == DragInfo::Phase::Move;
+    }
+    static std::uint64_t hash(const Key& k) { return k; }
+};
+
+// Colliders raise every frame they overlap; one event per (a, b) per frame is enough
+template <>
+struct EventCoalesce<CollisionInfo> {
+    static constexpr CoalescePolicy kPolicy = CoalescePolicy::OncePerFrame;
+    struct Key {
+        const Entity* a;
+        const Entity* b;
+        bool operator==(const Key& o) const { return a == o.a && b == o.b; }
+    };
+    static bool key(const CollisionInfo& e, Key& out) {
+        out = Key{ e.a, e.b };
+        return true;
+    }
+    static std::uint64_t hash(const Key& k) {
+        const auto a = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(k.a));
+        const auto b = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(k.b));
+        return a * 0x9E3779B97F4A7C15ull ^ (b + (b << 17) + (b >> 31));
+    }
+};
+
+// Small open-addressed map from a coalescing key to a value. clear() keeps the buckets, so a
+// table that has seen a frame's worth of keys stops allocating. No erase: callers check
+// whether what a value points at is still current.
+template <typename Policy>
+class CoalesceTable {
+public:
+    using Key = typename Policy::Key;
+
+    const std::uint32_t* find(const Key& key) const {
+        if (size_ == 0) return nullptr;
+        const size_t mask = buckets_.size() - 1;
+        for (size_t i = slotOf(key); ; i = (i + 1) & mask) {
+            const Bucket& b = buckets_[i];
+            if (!b.used) return nullptr;
+            if (b.key == key) return &b.value;
+        }
+    }
+
+    // Inserts or overwrites
+    void set(const Key& key, std::uint32_t value) {
+        if ((size_ + 1) * 2 > buckets_.size()) grow();
+        const size_t mask = buckets_.size() - 1;
+        for (size_t i = slotOf(key); ; i = (i + 1) & mask) {
+            Bucket& b = buckets_[i];
+            if (!b.used) {
+                b = Bucket{ key, value, true };
+                ++size_;
+                return;
+            }
+            if (b.key == key) {
+                b.value = value;
+                return;
+            }
+        }
+    }
+
+    void clear() {
+        if (size_ == 0) return;
+        for (Bucket& b : buckets_) b.used = false;
+        size_ = 0;
+    }
+
+private:
+    struct Bucket {
+        Key           key;
+        std::uint32_t value;
+        bool          used;
+    };
+
+    size_t slotOf(const Key& key) const {
+        // Fibonacci hashing; the top bits are the best mixed
+        return static_cast<size_t>((Policy::hash(key) * 0x9E3779B97F4A7C15ull) >> (64 - shift_));
+    }
+
+    void grow() {
+        std::vector<Bucket> old = std::move(buckets_);
+        shift_ = old.empty() ? 4 : shift_ + 1;
+        buckets_.assign(size_t(1) << shift_, Bucket{ Key{}, 0, false });
+        size_ = 0;
+        for (const Bucket& b : old) {
+            if (b.used) set(b.key, b.value);
+        }
+    }
+
+    std::vector<Bucket> buckets_;
+    size_t   size_ = 0;
+    unsigned shift_ = 0;
+};
@@ -1,7 +1,9 @@
 #pragma once
 #include "Event.h"
 
+// Handler for one payload type (one EventManager channel)
+template <typename T>
 struct EventHandler {
     virtual ~EventHandler() = default;
-    virtual void onEvent(const Event& e) = 0;
+    virtual void onEvent(const T& e) = 0;
 };
@@ -1,38 +1,43 @@
 #include "events/EventManager.h"
 
-EventManager::EventManager(Timeline& timeline) : timeline_(timeline) {}
-
-EventManager::ListenerId EventManager::subscribe(EventType type, Listener cb) {
-    const auto id = nextId_++;
-    listeners_[type].emplace(id, std::move(cb));
-    return id;
+EventManager::EventManager(Timeline& timeline)
+    : timeline_(timeline), owner_(std::this_thread::get_id()) {
+    std::apply([this](auto&... c) { all_ = { &c... }; }, channels_);
 }
 
-void EventManager::unsubscribe(EventType type, ListenerId id) {
-    auto it = listeners_.find(type);
-    if (it != listeners_.end()) {
-        it->second.erase(id);
+void EventManager::dispatch() {
+    // Drain before every pop: events raised by listeners (or other threads) meanwhile
+    // are ordered against what is still queued. The next event is the earliest head
+    // across all channels, so priority/timestamp/FIFO order holds between payload types.
+    for (;;) {
+        EventChannelBase* next = nullptr;
+        for (EventChannelBase* c : all_) {
+            c->drain(timeline_);
+            const EventKey* key = c->top();
+            if (key && (!next || dispatchesBefore(*key, *next->top()))) next = c;
+        }
+        if (!next) break;
+        next->deliverTop();
     }
+    for (EventChannelBase* c : all_) c->endFrame();
+    swapArenas();
 }
 
-void EventManager::raise(Event e) {
-    if (e.timestamp <= 0.0f) {
-        // NOTE: Timeline::getElapsedTime() is used to time-stamp events
-        e.timestamp = timeline_.getElapsedTime();
+unsigned EventManager::enterArena() {
+    for (;;) {
+        const unsigned epoch = arenaEpoch_.load();
+        const unsigned index = epoch & 1u;
+        arenaUsers_[index].fetch_add(1);
+        if (arenaEpoch_.load() == epoch) return index;
+        arenaUsers_[index].fetch_sub(1); // swapped meanwhile; use the new one
     }
-    queue_.push(QItem{ std::move(e), nextSeq_++ });
 }
 
-void EventManager::dispatch() {
-    while (!queue_.empty()) {
-        auto q = queue_.top(); queue_.pop();
-        auto it = listeners_.find(q.event.type);
-        if (it == listeners_.end()) continue;
-
-        // deliver to a snapshot of listeners (stable under modifications)
-        auto snapshot = it->second;
-        for (auto& kv : snapshot) {
-            kv.second(q.event);
-        }
-    }
+void EventManager::swapArenas() {
+    const unsigned epoch = arenaEpoch_.load();
+    const unsigned spare = (epoch + 1) & 1u;
+    // A node may still be in an inbox (pushed after the last drain); try again next frame
+    if (arenaUsers_[spare].load() != 0 || !arenas_[spare].idle()) return;
+    arenas_[spare].reset();
+    arenaEpoch_.store(epoch + 1);
 }
@@ -1,53 +1,90 @@
 #pragma once
 #include "events/Event.h"
+#include "events/EventChannel.h"
+#include "events/FrameArena.h"
 #include "Timeline.h"
-#include <queue>
-#include <unordered_map>
-#include <vector>
-#include <functional>
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <thread>
+#include <tuple>
 
+// One channel per payload type: subscribe<DragInfo>(fn) only ever sees DragInfo, and
+// raise<CollisionInfo>(...) only queues into the CollisionInfo channel. The channel is picked
+// at compile time; a payload type missing from Channels below is a compile error.
+//
+// raise() is thread safe: the owning thread (the one that constructed the manager) queues
+// directly, other threads go through a lock-free inbox per channel drained in dispatch().
+// Repeats are coalesced as they are queued (see EventCoalesce.h). Payloads are plain data
+// and inbox nodes come from per-frame arenas, so raise/dispatch stay off the heap once warm.
+// subscribe/unsubscribe/dispatch stay on the owning thread.
 class EventManager {
 public:
-    using Listener = std::function<void(const Event&)>;
-    using ListenerId = std::uint64_t;
+    using ListenerId = EventChannelBase::ListenerId;
+    template <typename T>
+    using Listener = typename EventChannel<T>::Listener;
 
     explicit EventManager(Timeline& timeline);
 
     // Registration
-    ListenerId subscribe(EventType type, Listener cb);
-    void unsubscribe(EventType type, ListenerId id);
+    template <typename T>
+    ListenerId subscribe(Listener<T> cb) {
+        return channel<T>().subscribe(nextId_++, std::move(cb));
+    }
 
-    // Raising
-    void raise(Event e);                 // queues event (timestamp auto-filled if <= 0)
+    template <typename T>
+    void unsubscribe(ListenerId id) {
+        channel<T>().unsubscribe(id);
+    }
+
+    // Raising: queues from any thread (timestamp auto-filled if <= 0)
+    template <typename T>
+    void raise(T payload, EventPriority priority = EventPriority::Normal, float timestamp = 0.0f) {
+        const bool onOwner = std::this_thread::get_id() == owner_;
+        if (timestamp <= 0.0f && onOwner) {
+            // NOTE: Timeline::getElapsedTime() is used to time-stamp events.
+            // Other threads can't read the timeline safely; drain() stamps theirs.
+            timestamp = timeline_.getElapsedTime();
+        }
+        // The sequence number is taken here, so FIFO holds across threads and channels
+        const EventKey key{ priority, timestamp, nextSeq_.fetch_add(1, std::memory_order_relaxed) };
+        if (onOwner) {
+            channel<T>().enqueue(std::move(payload), key);
+            return;
+        }
+        const unsigned arena = enterArena();
+        channel<T>().push(std::move(payload), key, &arenas_[arena]);
+        arenaUsers_[arena].fetch_sub(1);
+    }
 
     // Handling
-    void dispatch();                     // drains queue in priority order
+    void dispatch();                     // drains all channels in priority order
 
 private:
-    struct QItem {
-        Event event;
-        std::uint64_t seq; // monotonically increasing tie-breaker
-    };
-
-    struct Compare {
-        bool operator()(const QItem& a, const QItem& b) const {
-            // lower priority enum value = higher priority
-            if (a.event.priority != b.event.priority) {
-                return static_cast<int>(a.event.priority) > static_cast<int>(b.event.priority);
-            }
-            // older timestamp first
-            if (a.event.timestamp != b.event.timestamp) {
-                return a.event.timestamp > b.event.timestamp;
-            }
-            // finally FIFO among identical priority/timestamp
-            return a.seq > b.seq;
-        }
-    };
+    using Channels = std::tuple<
+        EventChannel<InputAction>,
+        EventChannel<CollisionInfo>,
+        EventChannel<DeathInfo>,
+        EventChannel<SpawnInfo>,
+        EventChannel<DragInfo>
+    >;
+
+    template <typename T>
+    EventChannel<T>& channel() { return std::get<EventChannel<T>>(channels_); }
+
+    // Off-thread raises take inbox nodes from arenas_[arenaEpoch_ & 1]. Between frames
+    // dispatch() resets the other arena, once nothing in it is used, and switches to it.
+    // enterArena() returns the index and counts the caller in arenaUsers_ until it is done.
+    unsigned enterArena();
+    void swapArenas();
 
     Timeline& timeline_;
-    std::priority_queue<QItem, std::vector<QItem>, Compare> queue_;
-    std::unordered_map<EventType, std::unordered_map<ListenerId, Listener>> listeners_;
+    const std::thread::id owner_;
+    FrameArena arenas_[2];  // declared before channels_: inbox nodes are released into them
+    std::atomic<unsigned> arenaEpoch_{ 0 };
+    std::atomic<int> arenaUsers_[2]{};
+    Channels channels_;
+    std::array<EventChannelBase*, std::tuple_size<Channels>::value> all_; // channels_, type-erased
     ListenerId nextId_ = 1;
-    std::uint64_t nextSeq_ = 1;
+    std::atomic<std::uint64_t> nextSeq_{ 1 };
 };
@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+
+// Fixed-size bump allocator for a frame's worth of events raised off the owning thread.
+// allocate() is lock-free and callable from any thread; memory is never freed piecemeal.
+// The owner resets the whole arena once everything allocated from it has been released.
+class FrameArena {
+public:
+    static constexpr size_t kDefaultCapacity = 64 * 1024;
+
+    explicit FrameArena(size_t capacity = kDefaultCapacity)
+        : buffer_(new unsigned char[capacity]), capacity_(capacity) {}
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // nullptr when the arena is full; the caller falls back to the heap
+    void* allocate(size_t size, size_t align) {
+        assert(align <= alignof(std::max_align_t));
+        size_t used = used_.load(std::memory_order_relaxed);
+        for (;;) {
+            const size_t start = (used + align - 1) & ~(align - 1);
+            if (start + size > capacity_) return nullptr;
+            if (used_.compare_exchange_weak(used, start + size, std::memory_order_relaxed)) {
+                live_.fetch_add(1, std::memory_order_acq_rel);
+                return buffer_.get() + start;
+            }
+        }
+    }
+
+    // One allocation is no longer in use (its destructor has already run)
+    void release() { live_.fetch_sub(1, std::memory_order_acq_rel); }
+
+    bool idle() const { return live_.load(std::memory_order_acquire) == 0; }
+
+    // Owner only, with idle() true and no thread able to allocate from it
+    void reset() { used_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<unsigned char[]> buffer_;
+    const size_t        capacity_;
+    std::atomic<size_t> used_{ 0 };
+    std::atomic<size_t> live_{ 0 };  // allocations not yet released
+};
@@ -1,11 +1,10 @@
 #include "EventHandler.h" // Make sure this exists and is included
 #include "Event.h"
 
-class InputHandler : public EventHandler {
+class InputHandler : public EventHandler<InputAction> {
 public:
-    void onEvent(const Event& e) override {
-        if (e.type == EventType::Input) {
-            // handle input event
-        }
+    void onEvent(const InputAction& e) override {
+        // handle input event
+        (void)e;
     }
 };
\ No newline at end of file
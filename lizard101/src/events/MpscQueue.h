@@ -0,0 +1,92 @@
+#pragma once
+#include "events/FrameArena.h"
+#include <atomic>
+#include <new>
+#include <utility>
+
+// Lock-free multi-producer / single-consumer queue (intrusive linked list with a stub node).
+// push() may be called from any thread; tryPop() only from the one consumer thread.
+// FIFO per producer; a push that is still linking in can briefly hide the ones after it,
+// which the consumer simply picks up on its next call.
+// Nodes come from the FrameArena passed to push() when it has room, otherwise from the heap.
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue() : head_(&stub_), tail_(&stub_) {}
+
+    ~MpscQueue() {
+        T discard;
+        while (tryPop(discard)) {}
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void push(T value, FrameArena* arena = nullptr) {
+        void* mem = arena ? arena->allocate(sizeof(Node), alignof(Node)) : nullptr;
+        Node* node = mem ? new (mem) Node(std::move(value), arena) : new Node(std::move(value), nullptr);
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    bool tryPop(T& out) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        if (tail == &stub_) {
+            if (!next) return false; // empty
+            // Step past the stub
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            tail_ = next;
+            out = std::move(tail->value);
+            destroy(tail);
+            return true;
+        }
+
+        // tail is the last linked node; if a producer is mid-push, try again later
+        if (tail != head_.load(std::memory_order_acquire)) return false;
+
+        // Put the stub back behind tail so tail can be handed out
+        pushStub();
+        next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+        tail_ = next;
+        out = std::move(tail->value);
+        destroy(tail);
+        return true;
+    }
+
+private:
+    struct Node {
+        Node() = default;
+        Node(T v, FrameArena* a) : value(std::move(v)), arena(a) {}
+        std::atomic<Node*> next{ nullptr };
+        T value{};
+        FrameArena* arena = nullptr; // owner of the memory, nullptr = heap
+    };
+
+    static void destroy(Node* node) {
+        if (FrameArena* arena = node->arena) {
+            node->~Node();
+            arena->release();
+        }
+        else {
+            delete node;
+        }
+    }
+
+    void pushStub() {
+        stub_.next.store(nullptr, std::memory_order_relaxed);
+        Node* prev = head_.exchange(&stub_, std::memory_order_acq_rel);
+        prev->next.store(&stub_, std::memory_order_release);
+    }
+
+    Node               stub_;
+    std::atomic<Node*> head_; // producers push here
+    Node*              tail_; // consumer pops here
+};
@@ -1,8 +1,7 @@
-class SpawnHandler : public EventHandler {
+class SpawnHandler : public EventHandler<SpawnInfo> {
 public:
-    void onEvent(Event e);
+    void onEvent(const SpawnInfo& e);
 }
-void SpawnHandler::onEvent(Event e) {
-    if (e.type == "Spawn")
-        //handle the event
+void SpawnHandler::onEvent(const SpawnInfo& e) {
+    //handle the event
 }
\ No newline at end of file
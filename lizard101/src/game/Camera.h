@@ -107,6 +107,32 @@ public:
         return SDL_FRect{ world.x - x_, world.y - y_, world.w, world.h };
     }
 
+    // Size of the visible screen area (render output size)
+    void setViewportSize(float w, float h) {
+        viewW_ = w;
+        viewH_ = h;
+    }
+
+    float getViewportWidth() const {
+        return viewW_;
+    }
+
+    float getViewportHeight() const {
+        return viewH_;
+    }
+
+    // The world rect the viewport shows
+    SDL_FRect worldView() const {
+        return SDL_FRect{ x_, y_, viewW_, viewH_ };
+    }
+
+    // True if any part of the world rect lands inside the viewport
+    bool isVisible(const SDL_FRect& world) const {
+        SDL_FRect s = worldToScreen(world);
+        return (s.x + s.w) > 0.0f && s.x < viewW_ &&
+               (s.y + s.h) > 0.0f && s.y < viewH_;
+    }
+
 private:
     Camera() = default;
     float x_ = 0.0f;
@@ -115,6 +141,8 @@ private:
     float minY_ = 0.0f;
     float maxX_ = 1e9f;
     float maxY_ = 1e9f;
+    float viewW_ = 1920.0f;
+    float viewH_ = 1080.0f;
 
     // Store bounds and positions of the camera
     float clampX(float x) const {
@@ -3,6 +3,7 @@
 #include "main.h"              // gEventLogEnabled / EVENT_LOG again, should in theory be changed, but fine for now
 #include "Input.h"
 #include "game/components/TextureRenderer.h"
+#include "TextureAtlas.h"
 #include "game/components/BoxCollider.h"
 #include "game/components/DebugRenderer.h"
 #include "Camera.h"
@@ -26,24 +27,52 @@ Lizard101Controller::Lizard101Controller(SDL_Renderer* renderer,
     , timeline_(timeline)
     , eventManager_(eventManager)
     , manager_(entityManager)
+    , ui_(entityManager)
 {
     // Camera bounds for card game
     Camera::getInstance().setBounds(0.0f, 0.0f, 1920.0f, 1080.0f);
     Camera::getInstance().setPosition(0.0f, 0.0f);
 
+    buildSpriteAtlas();
     setupEventSubscriptions();
 }
 
+// ----------------- Sprite atlas -----------------
+
+void Lizard101Controller::buildSpriteAtlas() {
+    // Card art + actor sprites are drawn many times per frame; pack them so the hand and
+    // battlefield draw from a few atlas pages instead of one texture per image.
+    std::vector<std::string> paths;
+    for (const auto& def : LizardCards::getAllCards()) {
+        paths.push_back(def.texturePath);
+    }
+    const char* sprites[] = {
+        "media/plant-wizard.png",
+        "media/fire-wizard.png",
+        "media/water-wizard.png",
+        "media/Snake.png",
+        "media/Roadrunner.png",
+        "media/Hawk.png",
+        "media/mana-symbol.png",
+        "media/card-back.png",
+        "media/darkworld_platform_mossystone.png",
+    };
+    paths.insert(paths.end(), std::begin(sprites), std::end(sprites));
+
+    // Cards are drawn at ~180x260, so 512 keeps plenty of detail
+    TextureAtlas::getInstance().build(renderer_, paths, 2048, 512);
+}
+
 // ----------------- Event subscriptions -----------------
 
 void Lizard101Controller::setupEventSubscriptions() {
     // We don't need Collision for the card game right now, but keep hook if needed.
-    eventManager_.subscribe(EventType::Collision, [](const Event& ev) {
-        (void)ev;
+    eventManager_.subscribe<CollisionInfo>([](const CollisionInfo& ci) {
+        (void)ci;
         });
 
     // Drag handler: card dragging + targeting
-    eventManager_.subscribe(EventType::Input, [this](const Event& ev) {
+    eventManager_.subscribe<DragInfo>([this](const DragInfo& drag) {
         if (cardGame_.enemyTurnPending) return;
         if (cardGame_.players.empty())  return;
         if (cardGame_.activePlayerIndex < 0 ||
@@ -51,18 +80,15 @@ void Lizard101Controller::setupEventSubscriptions() {
             return;
         }
 
-        auto* di = std::get_if<DragInfo>(&ev.payload);
-        if (!di) return;
-
-        const float mx = di->x;
-        const float my = di->y;
+        const float mx = drag.x;
+        const float my = drag.y;
 
         auto pointIn = [](const SDL_FRect& r, float px, float py) {
             return (px >= r.x && px <= r.x + r.w &&
                 py >= r.y && py <= r.y + r.h);
             };
 
-        if (di->phase == DragInfo::Phase::Start) {
+        if (drag.phase == DragInfo::Phase::Start) {
             draggedCard_ = nullptr;
             draggedVisual_ = nullptr;
 
@@ -75,19 +101,19 @@ void Lizard101Controller::setupEventSubscriptions() {
                 if (pointIn(r, mx, my)) {
                     draggedCard_ = e;
                     draggedVisual_ = &cv;
-                    dragOffsetX_ = e->x - mx;
-                    dragOffsetY_ = e->y - my;
+                    dragOffsetX_ = e->getX() - mx;
+                    dragOffsetY_ = e->getY() - my;
                     break;
                 }
             }
         }
-        else if (di->phase == DragInfo::Phase::Move) {
+        else if (drag.phase == DragInfo::Phase::Move) {
             if (draggedCard_) {
-                draggedCard_->x = mx + dragOffsetX_;
-                draggedCard_->y = my + dragOffsetY_;
+                draggedCard_->setX(mx + dragOffsetX_);
+                draggedCard_->setY(my + dragOffsetY_);
             }
         }
-        else if (di->phase == DragInfo::Phase::End) {
+        else if (drag.phase == DragInfo::Phase::End) {
             if (cardGame_.players.empty()) return;
             CombatPlayer& active = cardGame_.activePlayer();
             if (!canActivePlayerAct()) {
@@ -215,12 +241,6 @@ SDL_Color Lizard101Controller::colorForDeckType(int deckType) const {
 }
 
 void Lizard101Controller::updateBackground() {
-
-    if (backgroundEntity_) {
-        manager_.removeEntity(backgroundEntity_);
-        backgroundEntity_ = nullptr;
-    }
-
     std::string bgPath;
     switch (gameState_) {
     case GameState::MainMenu:
@@ -243,12 +263,151 @@ void Lizard101Controller::updateBackground() {
         break;
     }
 
-    // Create background entity (full screen)
-    backgroundEntity_ = new Entity("Background", 0.0f, 0.0f, 1920, 1080);
-    backgroundEntity_->setTag("BACKGROUND");
-    backgroundEntity_->addComponent<TextureRenderer>(renderer_, bgPath);
-    //manager_.entities.insert(manager_.entities.begin(), backgroundEntity_);
-    manager_.addEntityToFront(backgroundEntity_);
+    // Already showing the right image: nothing to do this frame
+    if (backgroundEntity_ && bgPath == backgroundPath_) {
+        return;
+    }
+
+    if (backgroundEntity_) {
+        // Only the texture changes; the entity stays in the background layer
+        if (auto* tr = backgroundEntity_->getComponent<TextureRenderer>()) {
+            tr->setTexture(bgPath);
+        }
+    }
+    else {
+        // Create background entity (full screen)
+        backgroundEntity_ = newPooled<Entity>("Background", 0.0f, 0.0f, 1920, 1080);
+        backgroundEntity_->setTag("BACKGROUND");
+        backgroundEntity_->renderLayer = RenderLayer::Background;
+        backgroundEntity_->addComponent<TextureRenderer>(renderer_, bgPath);
+        manager_.commands().create(backgroundEntity_, pooledDeleter());
+    }
+    backgroundPath_ = bgPath;
+}
+
+// ----------------- Menu UI -----------------
+
+void Lizard101Controller::clearUI() {
+    ui_.clear();
+    uiScreen_ = UIScreen::None;
+    uiShownPlayer_ = -1;
+}
+
+void Lizard101Controller::destroyAllEntities() {
+    manager_.destroyAll();
+    backgroundEntity_ = nullptr;
+    backgroundPath_.clear();
+    ui_.forget();
+    uiScreen_ = UIScreen::None;
+    uiShownPlayer_ = -1;
+}
+
+void Lizard101Controller::buildMainMenu() {
+    clearUI();
+
+    int buttonW = 180, buttonH = 80;
+    float cx = 1920.0f * 0.5f;
+    float by = 450.0f;
+
+    const int numButtons = 3;
+    const float spacing = 40.0f;
+
+    float totalWidth = numButtons * buttonW + (numButtons - 1) * spacing;
+    float startX = cx - totalWidth * 0.5f;
+
+    // Button id == number of players - 1
+    for (int i = 0; i < numButtons; ++i) {
+        float bx = startX + i * (buttonW + spacing);
+        std::string texturePath =
+            "media/menu/" + std::to_string(i + 1) + "_player.png";
+        ui_.addWidget(WidgetKind::Button, i,
+            SDL_FRect{ bx, by, static_cast<float>(buttonW), static_cast<float>(buttonH) },
+            renderer_, texturePath);
+    }
+    uiScreen_ = UIScreen::MainMenu;
+}
+
+void Lizard101Controller::buildDeckSelect() {
+    clearUI();
+
+    int deckW = 180, deckH = 260;
+    float cx = 1920.0f * 0.5f;
+    SDL_Color deckColors[3] = {
+        {80,200,80,255}, {255,80,80,255}, {80,120,255,255}
+    };
+
+    {
+        int labelW = 360;
+        int labelH = 160;
+        float labelX = cx - labelW * 0.5f;
+        float labelY = 150.0f;
+        std::string labelTexturePath =
+            "media/menu/player_" + std::to_string(currentDeckSelectPlayer_ + 1) + "_deck.png";
+        ui_.addWidget(WidgetKind::Label, kDeckLabelId,
+            SDL_FRect{ labelX, labelY, static_cast<float>(labelW), static_cast<float>(labelH) },
+            renderer_, labelTexturePath);
+    }
+
+    // Deck tiles, id == deck type (0=Plant,1=Fire,2=Water)
+    const int numDecks = 3;
+    const float deckSpacing = 60.0f;
+    float totalWidth = numDecks * deckW + (numDecks - 1) * deckSpacing;
+    float startX = cx - totalWidth * 0.5f;
+    float deckY = 400.0f;
+    for (int i = 0; i < numDecks; ++i) {
+        float bx = startX + i * (deckW + deckSpacing);
+        ui_.addWidget(WidgetKind::Button, i,
+            SDL_FRect{ bx, deckY, static_cast<float>(deckW), static_cast<float>(deckH) },
+            deckColors[i]);
+    }
+    uiScreen_ = UIScreen::DeckSelect;
+    uiShownPlayer_ = currentDeckSelectPlayer_;
+}
+
+void Lizard101Controller::showCardRewardChoices(int pickingPlayer) {
+    auto& choices = cardRewardChoices_[pickingPlayer];
+    std::string labelTexturePath =
+        "media/menu/player_" + std::to_string(pickingPlayer + 1) + "_select.png";
+    auto cardTexture = [&](int i) {
+        return choices[i]->texturePath.empty() ?
+            std::string("media/darkworld_platform_mossystone.png") : choices[i]->texturePath;
+    };
+
+    if (uiScreen_ == UIScreen::CardReward) {
+        // Same layout, next player: swap textures in place
+        ui_.setTexture(kRewardLabelId, labelTexturePath);
+        for (int i = 0; i < 3; ++i) {
+            ui_.setTexture(i, cardTexture(i));
+        }
+        uiShownPlayer_ = pickingPlayer;
+        return;
+    }
+
+    clearUI();
+
+    // Show label at top
+    int labelW = 360, labelH = 160;
+    float cx = 1920.0f * 0.5f;
+    float labelX = cx - labelW * 0.5f;
+    float labelY = 150.0f;
+    ui_.addWidget(WidgetKind::Label, kRewardLabelId,
+        SDL_FRect{ labelX, labelY, static_cast<float>(labelW), static_cast<float>(labelH) },
+        renderer_, labelTexturePath);
+
+    // Show 3 card choices, slot id == choice index
+    int cardW = 180, cardH = 260;
+    const float cardSpacing = 60.0f;
+    float totalWidth = 3 * cardW + 2 * cardSpacing;
+    float startX = cx - totalWidth * 0.5f;
+    float cardY = 400.0f;
+    for (int i = 0; i < 3; ++i) {
+        float bx = startX + i * (cardW + cardSpacing);
+        ui_.addWidget(WidgetKind::CardSlot, i,
+            SDL_FRect{ bx, cardY, static_cast<float>(cardW), static_cast<float>(cardH) },
+            renderer_, cardTexture(i));
+    }
+    uiScreen_ = UIScreen::CardReward;
+    uiShownPlayer_ = pickingPlayer;
 }
 
 // ----------------- Deck helper -----------------
@@ -313,11 +472,6 @@ std::vector<const CardDefinition*> Lizard101Controller::getRandomCardChoices() {
 
 void Lizard101Controller::updateCardReward() {
     updateBackground();
-    // Clear previous entities
-    for (Entity* e : menuButtonEntities_) {
-        manager_.removeEntity(e);
-    }
-    menuButtonEntities_.clear();
 
     bool curMouseL = Input::isMouseButtonPressed(SDL_BUTTON_LMASK);
     float mx = Input::mouseX();
@@ -333,54 +487,25 @@ void Lizard101Controller::updateCardReward() {
     }
 
     if (pickingPlayer != -1) {
-        // Show label at top
-        int labelW = 360, labelH = 160;
-        float cx = 1920.0f * 0.5f;
-        float labelX = cx - labelW * 0.5f;
-        float labelY = 150.0f;
-        Entity* labelEntity = new Entity("CardRewardPlayerLabel", labelX, labelY, labelW, labelH);
-        labelEntity->setTag("CARD_REWARD_PLAYER_LABEL");
-        std::string labelTexturePath =
-            "media/menu/player_" + std::to_string(pickingPlayer + 1) + "_select.png";
-        labelEntity->addComponent<TextureRenderer>(renderer_, labelTexturePath);
-        manager_.addEntity(labelEntity);
-        menuButtonEntities_.push_back(labelEntity);
-
-        // Show 3 card choices
-        int cardW = 180, cardH = 260;
-        const float cardSpacing = 60.0f;
-        float totalWidth = 3 * cardW + 2 * cardSpacing;
-        float startX = cx - totalWidth * 0.5f;
-        float cardY = 400.0f;
-
-        auto& choices = cardRewardChoices_[pickingPlayer];
-        for (int i = 0; i < 3; ++i) {
-            float bx = startX + i * (cardW + cardSpacing);
-            float by = cardY;
-            Entity* cardEntity = new Entity("CardRewardButton", bx, by, cardW, cardH);
-            cardEntity->setTag("CARD_REWARD_BUTTON");
-            // Show card art or fallback color
-            std::string texturePath = choices[i]->texturePath.empty() ?
-                "media/darkworld_platform_mossystone.png" : choices[i]->texturePath;
-            cardEntity->addComponent<TextureRenderer>(renderer_, texturePath);
-            manager_.addEntity(cardEntity);
-            menuButtonEntities_.push_back(cardEntity);
-
-            // Click handling
-            if (!waitingForRelease_ && curMouseL && !prevMouseLDeckSelect_) {
-                if (mx >= bx && mx <= bx + cardW &&
-                    my >= by && my <= by + cardH) {
-                    cardRewardSelections_[pickingPlayer] = i;
-                    // Add 3 copies to player's deck
-                    int nextInstanceId = static_cast<int>(cardGame_.players[pickingPlayer].deck.cards.size()) + 1;
-                    for (int c = 0; c < 3; ++c) {
-                        cardGame_.players[pickingPlayer].deck.cards.push_back(CardInstance{ choices[i], nextInstanceId++ });
-                    }
-                    cardGame_.players[pickingPlayer].earnedRewardCards.push_back(choices[i]);
-                    waitingForRelease_ = true;
-                    break;
-                }
+        // Label + 3 card choices; only touched when the picking player changes
+        if (uiScreen_ != UIScreen::CardReward || uiShownPlayer_ != pickingPlayer) {
+            showCardRewardChoices(pickingPlayer);
+        }
+
+        int hit = ui_.hitTest(mx, my);
+        ui_.setHovered(hit);
+
+        // Click handling
+        if (hit >= 0 && !waitingForRelease_ && curMouseL && !prevMouseLDeckSelect_) {
+            auto& choices = cardRewardChoices_[pickingPlayer];
+            cardRewardSelections_[pickingPlayer] = hit;
+            // Add 3 copies to player's deck
+            int nextInstanceId = static_cast<int>(cardGame_.players[pickingPlayer].deck.cards.size()) + 1;
+            for (int c = 0; c < 3; ++c) {
+                cardGame_.players[pickingPlayer].deck.cards.push_back(CardInstance{ choices[hit], nextInstanceId++ });
             }
+            cardGame_.players[pickingPlayer].earnedRewardCards.push_back(choices[hit]);
+            waitingForRelease_ = true;
         }
 
         if (!curMouseL && waitingForRelease_) {
@@ -419,7 +544,7 @@ void Lizard101Controller::updateCardReward() {
                 }
                 else {
                     std::cout << "[GAME END] All levels won! Lizards win!\n";
-                    manager_.destroyAll();
+                    destroyAllEntities();
                     resetGameState();
                     gameState_ = GameState::MainMenu;
                     cardGameInitialized_ = false;
@@ -445,7 +570,6 @@ void Lizard101Controller::resetGameState() {
     enemyEntities_.clear();
     enemyOverlays_.clear();
     playerOverlays_.clear();
-    menuButtonEntities_.clear();
     playZoneEntity_ = nullptr;
 
     draggedCard_ = nullptr;
@@ -466,21 +590,20 @@ void Lizard101Controller::resetGameState() {
 }
 
 void Lizard101Controller::clearAllVisualsAndEntities() {
-    for (Entity* e : menuButtonEntities_) manager_.removeEntity(e);
-    menuButtonEntities_.clear();
-    for (auto& hv : heroVisuals_) if (hv.entity) manager_.removeEntity(hv.entity);
+    clearUI();
+    for (auto& hv : heroVisuals_) if (hv.entity) manager_.commands().destroy(hv.entity);
     heroVisuals_.clear();
-    for (auto* e : enemyEntities_) if (e) manager_.removeEntity(e);
+    for (auto* e : enemyEntities_) if (e) manager_.commands().destroy(e);
     enemyEntities_.clear();
-    for (auto* e : enemyOverlays_) if (e) manager_.removeEntity(e);
+    for (auto* e : enemyOverlays_) if (e) manager_.commands().destroy(e);
     enemyOverlays_.clear();
-    for (auto* e : playerOverlays_) if (e) manager_.removeEntity(e);
+    for (auto* e : playerOverlays_) if (e) manager_.commands().destroy(e);
     playerOverlays_.clear();
-    for (auto* e : enemyAuraOverlays_) if (e) manager_.removeEntity(e);
+    for (auto* e : enemyAuraOverlays_) if (e) manager_.commands().destroy(e);
     enemyAuraOverlays_.clear();
-    for (auto* e : playerAuraOverlays_) if (e) manager_.removeEntity(e);
+    for (auto* e : playerAuraOverlays_) if (e) manager_.commands().destroy(e);
     playerAuraOverlays_.clear();
-    if (playZoneEntity_) { manager_.removeEntity(playZoneEntity_); playZoneEntity_ = nullptr; }
+    if (playZoneEntity_) { manager_.commands().destroy(playZoneEntity_); playZoneEntity_ = nullptr; }
     handVisuals_.clear();
     manaSymbolEntities_.clear();
     deckEntity_ = nullptr;
@@ -490,7 +613,7 @@ bool Lizard101Controller::checkGameEnd() {
     if (allPlayersDowned()) {
         std::cout << "[GAME END] All players are downed! Restarting to main menu...\n";
         clearAllVisualsAndEntities();
-        manager_.destroyAll();
+        destroyAllEntities();
         resetGameState();
         gameState_ = GameState::MainMenu;
         cardGameInitialized_ = false;
@@ -501,14 +624,14 @@ bool Lizard101Controller::checkGameEnd() {
         clearAllVisualsAndEntities();
         if (currentLevel_ >= maxLevels_) {
             std::cout << "[GAME END] All levels won! Lizards win!\n";
-            manager_.destroyAll();
+            destroyAllEntities();
             resetGameState();
             gameState_ = GameState::MainMenu;
             cardGameInitialized_ = false;
             return true;
         }
         if (cardRewardRound_ < maxCardRewardRounds_) {
-            manager_.destroyAll();
+            destroyAllEntities();
             gameState_ = GameState::CardReward;
             cardRewardRound_++;
             cardRewardChoices_.clear();
@@ -545,7 +668,7 @@ bool Lizard101Controller::checkGameEnd() {
         }
         else {
             std::cout << "[GAME END] All levels won! Lizards win!\n";
-            manager_.destroyAll();
+            destroyAllEntities();
             resetGameState();
             gameState_ = GameState::MainMenu;
             cardGameInitialized_ = false;
@@ -570,22 +693,23 @@ void Lizard101Controller::ensureDeathOverlays() {
 
         if (enemy.hp <= 0) {
             if (!enemyOverlays_[i]) {
-                enemyOverlays_[i] = new Entity(
+                enemyOverlays_[i] = newPooled<Entity>(
                     "EnemyDeadOverlay",
-                    eEntity->x, eEntity->y,
-                    eEntity->width, eEntity->height
+                    eEntity->getX(), eEntity->getY(),
+                    eEntity->getWidth(), eEntity->getHeight()
                 );
                 enemyOverlays_[i]->setTag("ENEMY_DEAD");
+                enemyOverlays_[i]->renderLayer = RenderLayer::Overlays;
                 enemyOverlays_[i]->addComponent<DebugRenderer>(
                     SDL_Color{ 255, 0, 0, 120 });
-                manager_.addEntity(enemyOverlays_[i]);
+                manager_.commands().create(enemyOverlays_[i], pooledDeleter());
                 std::cout << "[ENEMY DOWNED] " << enemy.name
                     << " defeated - overlay created\n";
             }
         }
         else {
             if (enemyOverlays_[i]) {
-                manager_.removeEntity(enemyOverlays_[i]);
+                manager_.commands().destroy(enemyOverlays_[i]);
                 enemyOverlays_[i] = nullptr;
                 std::cout << "[ENEMY REVIVED] " << enemy.name
                     << " revived - overlay removed\n";
@@ -605,22 +729,23 @@ void Lizard101Controller::ensureDeathOverlays() {
 
         if (player.hp <= 0) {
             if (!playerOverlays_[i]) {
-                playerOverlays_[i] = new Entity(
+                playerOverlays_[i] = newPooled<Entity>(
                     "PlayerDeadOverlay",
-                    heroEntity->x, heroEntity->y,
-                    heroEntity->width, heroEntity->height
+                    heroEntity->getX(), heroEntity->getY(),
+                    heroEntity->getWidth(), heroEntity->getHeight()
                 );
                 playerOverlays_[i]->setTag("PLAYER_DEAD");
+                playerOverlays_[i]->renderLayer = RenderLayer::Overlays;
                 playerOverlays_[i]->addComponent<DebugRenderer>(
                     SDL_Color{ 0, 0, 255, 120 });
-                manager_.addEntity(playerOverlays_[i]);
+                manager_.commands().create(playerOverlays_[i], pooledDeleter());
                 std::cout << "[PLAYER DOWNED] " << player.name
                     << " downed - overlay created\n";
             }
         }
         else {
             if (playerOverlays_[i]) {
-                manager_.removeEntity(playerOverlays_[i]);
+                manager_.commands().destroy(playerOverlays_[i]);
                 playerOverlays_[i] = nullptr;
                 std::cout << "[PLAYER REVIVED] " << player.name
                     << " revived - overlay removed\n";
@@ -645,30 +770,31 @@ void Lizard101Controller::ensureAuraOverlays() {
 
         if (shouldShow) {
             if (!overlay) {
-                float fullW = eEntity->width;
-                float fullH = eEntity->height;
+                float fullW = eEntity->getWidth();
+                float fullH = eEntity->getHeight();
                 float h = fullH * 0.25f;
-                float y = eEntity->y + fullH - h;
+                float y = eEntity->getY() + fullH - h;
 
-                overlay = new Entity("EnemyAuraOverlay",
-                    eEntity->x, y, fullW, h);
+                overlay = newPooled<Entity>("EnemyAuraOverlay",
+                    eEntity->getX(), y, fullW, h);
                 overlay->setTag("ENEMY_AURA");
+                overlay->renderLayer = RenderLayer::Overlays;
                 overlay->addComponent<DebugRenderer>(
                     SDL_Color{ 255, 255, 0, 120 });
-                manager_.addEntity(overlay);
+                manager_.commands().create(overlay, pooledDeleter());
                 std::cout << "[AURA VIS] Enemy aura overlay created for "
                     << enemy.name << "\n";
             }
             else {
-                overlay->x = eEntity->x;
-                float fullH = eEntity->height;
-                float h = overlay->height;
-                overlay->y = eEntity->y + fullH - h;
+                overlay->setX(eEntity->getX());
+                float fullH = eEntity->getHeight();
+                float h = overlay->getHeight();
+                overlay->setY(eEntity->getY() + fullH - h);
             }
         }
         else {
             if (overlay) {
-                manager_.removeEntity(overlay);
+                manager_.commands().destroy(overlay);
                 overlay = nullptr;
                 std::cout << "[AURA VIS] Enemy aura overlay removed for "
                     << enemy.name << "\n";
@@ -691,30 +817,31 @@ void Lizard101Controller::ensureAuraOverlays() {
 
         if (shouldShow) {
             if (!overlay) {
-                float fullW = heroEntity->width;
-                float fullH = heroEntity->height;
+                float fullW = heroEntity->getWidth();
+                float fullH = heroEntity->getHeight();
                 float h = fullH * 0.25f;
-                float y = heroEntity->y + fullH - h;
+                float y = heroEntity->getY() + fullH - h;
 
-                overlay = new Entity("PlayerAuraOverlay",
-                    heroEntity->x, y, fullW, h);
+                overlay = newPooled<Entity>("PlayerAuraOverlay",
+                    heroEntity->getX(), y, fullW, h);
                 overlay->setTag("PLAYER_AURA");
+                overlay->renderLayer = RenderLayer::Overlays;
                 overlay->addComponent<DebugRenderer>(
                     SDL_Color{ 255, 255, 0, 120 });
-                manager_.addEntity(overlay);
+                manager_.commands().create(overlay, pooledDeleter());
                 std::cout << "[AURA VIS] Player aura overlay created for "
                     << player.name << "\n";
             }
             else {
-                overlay->x = heroEntity->x;
-                float fullH = heroEntity->height;
-                float h = overlay->height;
-                overlay->y = heroEntity->y + fullH - h;
+                overlay->setX(heroEntity->getX());
+                float fullH = heroEntity->getHeight();
+                float h = overlay->getHeight();
+                overlay->setY(heroEntity->getY() + fullH - h);
             }
         }
         else {
             if (overlay) {
-                manager_.removeEntity(overlay);
+                manager_.commands().destroy(overlay);
                 overlay = nullptr;
                 std::cout << "[AURA VIS] Player aura overlay removed for "
                     << player.name << "\n";
@@ -735,20 +862,20 @@ void Lizard101Controller::rebuildHandVisuals() {
     // Destroy old cards
     for (auto& cv : handVisuals_) {
         if (cv.entity) {
-            manager_.removeEntity(cv.entity);
+            manager_.commands().destroy(cv.entity);
         }
     }
     handVisuals_.clear();
 
     // Destroy old mana symbols
     for (auto* e : manaSymbolEntities_) {
-        if (e) manager_.removeEntity(e);
+        if (e) manager_.commands().destroy(e);
     }
     manaSymbolEntities_.clear();
 
     // Destroy old deck entity
     if (deckEntity_) {
-        manager_.removeEntity(deckEntity_);
+        manager_.commands().destroy(deckEntity_);
         deckEntity_ = nullptr;
     }
 
@@ -782,8 +909,9 @@ void Lizard101Controller::rebuildHandVisuals() {
         float x = startX + i * spacing;
         float y = handY;
 
-        Entity* e = new Entity("Card", x, y, cardW, cardH);
+        Entity* e = newPooled<Entity>("Card", x, y, cardW, cardH);
         e->setTag("CARD");
+        e->renderLayer = RenderLayer::Hand;
 
         const CardInstance& ci = hand[static_cast<size_t>(i)];
 
@@ -809,7 +937,7 @@ void Lizard101Controller::rebuildHandVisuals() {
         auto& colComp = e->addComponent<BoxCollider>();
         colComp.setEventManager(&eventManager_);
 
-        manager_.addEntity(e);
+        manager_.commands().create(e, pooledDeleter());
         handVisuals_.push_back(CardVisual{ e, static_cast<size_t>(i) });
     }
 
@@ -821,10 +949,11 @@ void Lizard101Controller::rebuildHandVisuals() {
 
     for (int i = 0; i < active.mana; ++i) {
         float x = manaStartX + i * manaSymbolW;
-        Entity* manaEntity = new Entity("ManaSymbol", x, manaY, manaSymbolW, manaSymbolH);
+        Entity* manaEntity = newPooled<Entity>("ManaSymbol", x, manaY, manaSymbolW, manaSymbolH);
         manaEntity->setTag("MANA_SYMBOL");
+        manaEntity->renderLayer = RenderLayer::Hand;
         manaEntity->addComponent<TextureRenderer>(renderer_, "media/mana-symbol.png");
-        manager_.addEntity(manaEntity);
+        manager_.commands().create(manaEntity, pooledDeleter());
         manaSymbolEntities_.push_back(manaEntity);
     }
 
@@ -834,53 +963,51 @@ void Lizard101Controller::rebuildHandVisuals() {
     float deckX = 1920.0f - deckW - 60.0f; // 40px margin from right
     float deckY = 1080.0f - deckH - 40.0f; // 40px margin from bottom
 
-    deckEntity_ = new Entity("DeckCardBack", deckX, deckY, deckW, deckH);
+    deckEntity_ = newPooled<Entity>("DeckCardBack", deckX, deckY, deckW, deckH);
     deckEntity_->setTag("DECK_CARD_BACK");
+    deckEntity_->renderLayer = RenderLayer::Hand;
     deckEntity_->addComponent<TextureRenderer>(renderer_, "media/card-back.png");
-    manager_.addEntity(deckEntity_);
+    manager_.commands().create(deckEntity_, pooledDeleter());
 }
 
 // ----------------- Gameplay init -----------------
 
 void Lizard101Controller::initGameplay() {
     // Clean previous entities
-    for (Entity* e : menuButtonEntities_) {
-        manager_.removeEntity(e);
-    }
-    menuButtonEntities_.clear();
+    clearUI();
 
     for (auto& hv : heroVisuals_) {
-        if (hv.entity) manager_.removeEntity(hv.entity);
+        if (hv.entity) manager_.commands().destroy(hv.entity);
     }
     heroVisuals_.clear();
 
     for (auto* e : enemyEntities_) {
-        if (e) manager_.removeEntity(e);
+        if (e) manager_.commands().destroy(e);
     }
     enemyEntities_.clear();
 
     for (auto* e : enemyOverlays_) {
-        if (e) manager_.removeEntity(e);
+        if (e) manager_.commands().destroy(e);
     }
     enemyOverlays_.clear();
 
     for (auto* e : playerOverlays_) {
-        if (e) manager_.removeEntity(e);
+        if (e) manager_.commands().destroy(e);
     }
     playerOverlays_.clear();
 
     for (auto* e : enemyAuraOverlays_) {
-        if (e) manager_.removeEntity(e);
+        if (e) manager_.commands().destroy(e);
     }
     enemyAuraOverlays_.clear();
 
     for (auto* e : playerAuraOverlays_) {
-        if (e) manager_.removeEntity(e);
+        if (e) manager_.commands().destroy(e);
     }
     playerAuraOverlays_.clear();
 
     if (playZoneEntity_) {
-        manager_.removeEntity(playZoneEntity_);
+        manager_.commands().destroy(playZoneEntity_);
         playZoneEntity_ = nullptr;
     }
 
@@ -966,12 +1093,13 @@ void Lizard101Controller::initGameplay() {
         float x = 1920.0f * 0.5f - zoneW * 0.5f;
         float y = 1080.0f * 0.5f - zoneH * 0.5f;
 
-        playZoneEntity_ = new Entity("PlayZone", x, y, zoneW, zoneH);
+        playZoneEntity_ = newPooled<Entity>("PlayZone", x, y, zoneW, zoneH);
         playZoneEntity_->setTag("PLAY_ZONE");
+        playZoneEntity_->renderLayer = RenderLayer::World;
         auto& col = playZoneEntity_->addComponent<BoxCollider>();
         col.setEventManager(&eventManager_);
         playZoneEntity_->addComponent<DebugRenderer>(SDL_Color{ 0, 255, 0, 80 });
-        manager_.addEntity(playZoneEntity_);
+        manager_.commands().create(playZoneEntity_, pooledDeleter());
     }
 
     // Enemy entities (right side)
@@ -987,14 +1115,15 @@ void Lizard101Controller::initGameplay() {
         for (int i = 0; i < numEnemies; ++i) {
             float x = baseX + offsetX[i];
             float y = baseY + offsetY[i];
-            Entity* e = new Entity("EnemyEntity", x, y, actorW, actorH);
+            Entity* e = newPooled<Entity>("EnemyEntity", x, y, actorW, actorH);
             e->setTag("ENEMY_" + std::to_string(i));
+            e->renderLayer = RenderLayer::Actors;
             e->addComponent<TextureRenderer>(
                 renderer_,
                 enemySprites[i]
             );
             e->addComponent<BoxCollider>();
-            manager_.addEntity(e);
+            manager_.commands().create(e, pooledDeleter());
             enemyEntities_.push_back(e);
         }
     }
@@ -1019,8 +1148,9 @@ void Lizard101Controller::initGameplay() {
             float x = baseX + offsetX[i];
             float y = centerY + offsetY[i];
             int deckType = playerDeckChoices_[i];
-            Entity* heroEntity = new Entity("HeroEntity", x, y, actorW, actorH);
+            Entity* heroEntity = newPooled<Entity>("HeroEntity", x, y, actorW, actorH);
             heroEntity->setTag("ACTOR");
+            heroEntity->renderLayer = RenderLayer::Actors;
 
             if (deckType >= 0 && deckType < 3) {
                 heroEntity->addComponent<TextureRenderer>(renderer_, deckSprites[deckType]);
@@ -1029,7 +1159,7 @@ void Lizard101Controller::initGameplay() {
                 // Fallback: colored rectangle if deck type is invalid
                 heroEntity->addComponent<DebugRenderer>(colorForDeckType(deckType));
             }
-            manager_.addEntity(heroEntity);
+            manager_.commands().create(heroEntity, pooledDeleter());
             heroVisuals_.push_back(HeroVisual{ heroEntity, playerDeckChoices_[i] });
         }
     }
@@ -1042,50 +1172,25 @@ void Lizard101Controller::initGameplay() {
 
 void Lizard101Controller::updateMainMenu() {
     updateBackground();
-    // Clear previous menu entities
-    for (Entity* e : menuButtonEntities_) {
-        manager_.removeEntity(e);
+    if (uiScreen_ != UIScreen::MainMenu) {
+        buildMainMenu();
     }
-    menuButtonEntities_.clear();
-
-    int buttonW = 180, buttonH = 80;
-    float cx = 1920.0f * 0.5f;
-    float by = 450.0f;
 
     float mx = Input::mouseX();
     float my = Input::mouseY();
     bool mouseDown = Input::isMouseButtonPressed(SDL_BUTTON_LMASK);
 
-    const int numButtons = 3;
-    const float spacing = 40.0f;
-
-    float totalWidth = numButtons * buttonW + (numButtons - 1) * spacing;
-    float startX = cx - totalWidth * 0.5f;
-
-    for (int i = 0; i < numButtons; ++i) {
-        float bx = startX + i * (buttonW + spacing);
-        Entity* buttonEntity = new Entity("MenuButton", bx, by, buttonW, buttonH);
-        buttonEntity->setTag("MENU_BUTTON");
-
-        std::string texturePath =
-            "media/menu/" + std::to_string(i + 1) + "_player.png";
-        buttonEntity->addComponent<TextureRenderer>(renderer_, texturePath);
-
-        manager_.addEntity(buttonEntity);
-        menuButtonEntities_.push_back(buttonEntity);
-
-        if (mouseDown &&
-            mx >= bx && mx <= bx + buttonW &&
-            my >= by && my <= by + buttonH) {
-            std::cout << "[menu] " << (i + 1) << " Player(s) selected\n";
-            selectedNumPlayers_ = i + 1;
-            playerDeckChoices_.assign(selectedNumPlayers_, -1);
-            currentDeckSelectPlayer_ = 0;
-            waitingForRelease_ = true;
-            prevMouseLDeckSelect_ = mouseDown;
-            gameState_ = GameState::DeckSelect;
-            break;
-        }
+    int hit = ui_.hitTest(mx, my);
+    ui_.setHovered(hit);
+
+    if (mouseDown && hit >= 0) {
+        std::cout << "[menu] " << (hit + 1) << " Player(s) selected\n";
+        selectedNumPlayers_ = hit + 1;
+        playerDeckChoices_.assign(selectedNumPlayers_, -1);
+        currentDeckSelectPlayer_ = 0;
+        waitingForRelease_ = true;
+        prevMouseLDeckSelect_ = mouseDown;
+        gameState_ = GameState::DeckSelect;
     }
 }
 
@@ -1093,84 +1198,43 @@ void Lizard101Controller::updateMainMenu() {
 
 void Lizard101Controller::updateDeckSelect() {
     updateBackground();
-    // Clear previous deck button entities
-    for (Entity* e : menuButtonEntities_) {
-        manager_.removeEntity(e);
-    }
-    menuButtonEntities_.clear();
 
     bool curMouseL = Input::isMouseButtonPressed(SDL_BUTTON_LMASK);
     float mx = Input::mouseX();
     float my = Input::mouseY();
 
     if (currentDeckSelectPlayer_ < selectedNumPlayers_) {
-        int deckW = 180, deckH = 260;
-        float cx = 1920.0f * 0.5f;
-        SDL_Color deckColors[3] = {
-            {80,200,80,255}, {255,80,80,255}, {80,120,255,255}
-        };
-
         const char* deckNames[3] = {
           "Plant Deck", "Fire Deck", "Water Deck"
         };
-        {
-            int labelW = 360;
-            int labelH = 160;
-            float labelX = cx - labelW * 0.5f;
-            float labelY = 150.0f;
-
-            Entity* labelEntity =
-                new Entity("DeckPlayerLabel", labelX, labelY, labelW, labelH);
-            labelEntity->setTag("DECK_PLAYER_LABEL");
 
+        if (uiScreen_ != UIScreen::DeckSelect) {
+            buildDeckSelect();
+        }
+        if (uiShownPlayer_ != currentDeckSelectPlayer_) {
+            // Swap the "Player N" label in place
             int playerIndex1Based = currentDeckSelectPlayer_ + 1;
-            std::string labelTexturePath =
-                "media/menu/player_" + std::to_string(playerIndex1Based) + "_deck.png";
-
-            labelEntity->addComponent<TextureRenderer>(renderer_, labelTexturePath);
-
-            manager_.addEntity(labelEntity);
-            menuButtonEntities_.push_back(labelEntity);
+            ui_.setTexture(kDeckLabelId,
+                "media/menu/player_" + std::to_string(playerIndex1Based) + "_deck.png");
+            uiShownPlayer_ = currentDeckSelectPlayer_;
         }
 
-        const int numDecks = 3;
-        const float deckSpacing = 60.0f;
-        float totalWidth = numDecks * deckW + (numDecks - 1) * deckSpacing;
-        float startX = cx - totalWidth * 0.5f;
-        float deckY = 400.0f;
-
-        // Click handling (using same positions)
-        if (!waitingForRelease_ && curMouseL && !prevMouseLDeckSelect_) {
-            for (int i = 0; i < numDecks; ++i) {
-                float bx = startX + i * (deckW + deckSpacing);
-                float by = deckY;
-                if (mx >= bx && mx <= bx + deckW &&
-                    my >= by && my <= by + deckH) {
-                    playerDeckChoices_[currentDeckSelectPlayer_] = i;
-                    std::cout << "[DECK] " << deckNames[i]
-                        << " for Player " << (currentDeckSelectPlayer_ + 1)
-                        << "\n";
-                    currentDeckSelectPlayer_++;
-                    waitingForRelease_ = true;
-                    break;
-                }
-            }
+        int hit = ui_.hitTest(mx, my);
+        ui_.setHovered(hit);
+
+        // Click handling
+        if (hit >= 0 && !waitingForRelease_ && curMouseL && !prevMouseLDeckSelect_) {
+            playerDeckChoices_[currentDeckSelectPlayer_] = hit;
+            std::cout << "[DECK] " << deckNames[hit]
+                << " for Player " << (currentDeckSelectPlayer_ + 1)
+                << "\n";
+            currentDeckSelectPlayer_++;
+            waitingForRelease_ = true;
         }
 
         if (!curMouseL && waitingForRelease_) {
             waitingForRelease_ = false;
         }
-
-        // Draw deck tiles (unchanged visuals, fixed positions)
-        for (int i = 0; i < numDecks; ++i) {
-            float bx = startX + i * (deckW + deckSpacing);
-            float by = deckY;
-            Entity* buttonEntity = new Entity("DeckButton", bx, by, deckW, deckH);
-            buttonEntity->setTag("DECK_BUTTON");
-            buttonEntity->addComponent<DebugRenderer>(deckColors[i]);
-            manager_.addEntity(buttonEntity);
-            menuButtonEntities_.push_back(buttonEntity);
-        }
     }
 
     if (currentDeckSelectPlayer_ >= selectedNumPlayers_) {
@@ -1194,17 +1258,17 @@ void Lizard101Controller::updateGameplay(float dt) {
     if (cardGame_.enemyTurnPending) {
         
         for (auto& cv : handVisuals_) {
-            if (cv.entity) manager_.removeEntity(cv.entity);
+            if (cv.entity) manager_.commands().destroy(cv.entity);
         }
         handVisuals_.clear();
 
         for (auto* e : manaSymbolEntities_) {
-            if (e) manager_.removeEntity(e);
+            if (e) manager_.commands().destroy(e);
         }
         manaSymbolEntities_.clear();
 
         if (deckEntity_) {
-            manager_.removeEntity(deckEntity_);
+            manager_.commands().destroy(deckEntity_);
             deckEntity_ = nullptr;
         }
 
@@ -1237,10 +1301,7 @@ void Lizard101Controller::updateGameplay(float dt) {
     float my = Input::mouseY();
 
     auto raiseDrag = [&](DragInfo::Phase phase, float x, float y) {
-        eventManager_.raise(Event{
-            EventType::Input, EventPriority::High, 0.0f,
-            EventPayload{ DragInfo{ phase, x, y } }
-            });
+        eventManager_.raise(DragInfo{ phase, x, y }, EventPriority::High);
         };
 
     if (curMouseL && !prevMouseL) {
@@ -1287,7 +1348,7 @@ void Lizard101Controller::updateGameplay(float dt) {
     if (cardGame_.enemyTurnPending) {
         // During enemy turns, hide the hand
         for (auto& cv : handVisuals_) {
-            if (cv.entity) manager_.removeEntity(cv.entity);
+            if (cv.entity) manager_.commands().destroy(cv.entity);
         }
         handVisuals_.clear();
 
@@ -1307,7 +1368,7 @@ void Lizard101Controller::updateGameplay(float dt) {
     // Engine-level systems
     eventManager_.dispatch();
     manager_.updateAll(dt);
-    physics_.updatePhysics(manager_, dt);
+    physics_.updatePhysics(dt);
     Camera::getInstance().update(dt);
 }
 
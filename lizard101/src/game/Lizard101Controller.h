@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <string>
 #include <SDL3/SDL.h>
 
 #include "game/Lizard101Core.h"
@@ -9,6 +10,7 @@
 #include "Physics.h"
 #include "Timeline.h"
 #include "events/EventManager.h"
+#include "game/UILayer.h"
 
 // Forward declarations
 class TextureRenderer;
@@ -22,6 +24,14 @@ enum class GameState {
     CardReward,
 };
 
+// Which menu screen the retained UI layer currently holds
+enum class UIScreen {
+    None,
+    MainMenu,
+    DeckSelect,
+    CardReward,
+};
+
 // Visual mapping for card + hand index
 struct CardVisual {
     Entity* entity = nullptr;
@@ -70,10 +80,18 @@ private:
     CardGameState cardGame_;
     bool          cardGameInitialized_ = false;
 
+    // Persistent background layer; its texture only changes with gameState_/currentLevel_
     Entity* backgroundEntity_ = nullptr;
+    std::string backgroundPath_;
+
+    // Retained menu widgets (built on screen entry, mutated in place afterwards)
+    UILayer  ui_;
+    UIScreen uiScreen_ = UIScreen::None;
+    int      uiShownPlayer_ = -1; // player whose label/choices the widgets currently show
+    static constexpr int kDeckLabelId = 100;
+    static constexpr int kRewardLabelId = 101;
 
     // Entities
-    std::vector<Entity*> menuButtonEntities_;
     std::vector<Entity*> enemyEntities_;
     std::vector<Entity*> enemyOverlays_;
     std::vector<Entity*> playerOverlays_;
@@ -115,6 +133,16 @@ private:
 
     // --- Internal helpers ---
     void updateBackground();
+    void buildSpriteAtlas();
+
+    // Menu screens (retained UI)
+    void buildMainMenu();
+    void buildDeckSelect();
+    void showCardRewardChoices(int pickingPlayer);
+    void clearUI();
+
+    // EntityManager::destroyAll plus dropping every cached entity pointer we hold
+    void destroyAllEntities();
 
     // Top-level per-state updates
     void updateMainMenu();
@@ -17,19 +17,16 @@ PauseButton::PauseButton(std::string name, float screenX, float screenY,
     screenY_(screenY) {
 }
 
-void PauseButton::update(float deltaTime) {
-    Entity::update(deltaTime);
-
+void PauseButton::update(float /*deltaTime*/) {
     // Make sure the pause button follows the camera and stays in the same screen position
     float camX = Camera::getInstance().getX();
     float camY = Camera::getInstance().getY();
-    x = screenX_ + camX;
-    y = screenY_ + camY;
+    setPosition(screenX_ + camX, screenY_ + camY);
 
     // Mouse is reported in screen coordinates; check against screen-space bounds for the button
     float mx = Input::mouseX();
     float my = Input::mouseY();
-    bool inBounds = (mx >= screenX_ && mx <= screenX_ + width && my >= screenY_ && my <= screenY_ + height);
+    bool inBounds = (mx >= screenX_ && mx <= screenX_ + getWidth() && my >= screenY_ && my <= screenY_ + getHeight());
     bool clicked = Input::isMouseButtonPressed(SDL_BUTTON_LMASK);
 
 
@@ -3,17 +3,25 @@
 #include "EntityManager.h"
 #include "game/components/TextureRenderer.h"
 #include "game/components/BoxCollider.h"
-#include <variant>
 #include <iostream>
 #include <cmath>
 
 Player::Player(std::string name, float x, float y, int w, int h, EventManager& evt)
     : Entity(std::move(name), x, y, w, h, /*physics*/true, /*solid*/false, "PLAYER"),
     eventMgr_(&evt) {
-    // Subscribe to Input events (keyboard + drag)
-    inputListenerId_ = eventMgr_->subscribe(EventType::Input, [this](const Event& e) {
-        this->onEvent(e);
+    // Subscribe to keyboard and drag input
+    inputListenerId_ = eventMgr_->subscribe<InputAction>([this](const InputAction& act) {
+        this->onInput(act);
         });
+    dragListenerId_ = eventMgr_->subscribe<DragInfo>([this](const DragInfo& drag) {
+        this->onDrag(drag);
+        });
+}
+
+Player::~Player() {
+    // The listeners capture this
+    eventMgr_->unsubscribe<InputAction>(inputListenerId_);
+    eventMgr_->unsubscribe<DragInfo>(dragListenerId_);
 }
 
 void Player::startDash(int dir) {
@@ -26,77 +34,71 @@ void Player::startDash(int dir) {
 
 
 
-void Player::onEvent(const Event& e) {
-    if (e.type != EventType::Input) return;
+// Keyboard actions (WASD, jump, dash, etc.)
+void Player::onInput(const InputAction& act) {
+    using K = InputAction::Kind;
+    switch (act.action) {
+    case K::MoveLeft:
+        controls_.left = act.pressed;
+        break;
 
-    // Keyboard actions (WASD, jump, dash, etc.)
-    if (const auto* act = std::get_if<InputAction>(&e.payload)) {
-        using K = InputAction::Kind;
-        switch (act->action) {
-        case K::MoveLeft:
-            controls_.left = act->pressed;
-            break;
-
-        case K::MoveRight:
-            controls_.right = act->pressed;
-            break;
-
-        case K::Jump:
-            if (act->pressed) {
-                // edge-trigger jump request
-                controls_.jumpRequest = true;
-            }
-            break;
+    case K::MoveRight:
+        controls_.right = act.pressed;
+        break;
 
-            // Dash actions from input chord
-        case K::DashLeft:
-            if (act->pressed) {
-                startDash(-1);
-            }
-            break;
+    case K::Jump:
+        if (act.pressed) {
+            // edge-trigger jump request
+            controls_.jumpRequest = true;
+        }
+        break;
 
-        case K::DashRight:
-            if (act->pressed) {
-                startDash(+1);
-            }
-            break;
+        // Dash actions from input chord
+    case K::DashLeft:
+        if (act.pressed) {
+            startDash(-1);
+        }
+        break;
 
-        case K::None:
-        default:
-            break;
+    case K::DashRight:
+        if (act.pressed) {
+            startDash(+1);
         }
-        return;
+        break;
+
+    case K::None:
+    default:
+        break;
     }
+}
 
-    // Mouse dragging actions
-    if (const auto* drag = std::get_if<DragInfo>(&e.payload)) {
-        float halfW = width * 0.5f;
-        float halfH = height * 0.5f;
-
-        switch (drag->phase) {
-        case DragInfo::Phase::Start: {
-            const bool inside =
-                (drag->x >= x && drag->x <= x + width &&
-                    drag->y >= y && drag->y <= y + height);
-            if (inside) {
-                isDragging = true;
-                physicsEnabled = false; // freeze physics while dragging
-            }
-            break;
-        }
-        case DragInfo::Phase::Move: {
-            if (isDragging) {
-                x = drag->x - halfW;
-                y = drag->y - halfH;
-            }
-            break;
-        }
-        case DragInfo::Phase::End: {
-            isDragging = false;
-            physicsEnabled = true; // hand back to physics
-            break;
+// Mouse dragging actions
+void Player::onDrag(const DragInfo& drag) {
+    float halfW = getWidth() * 0.5f;
+    float halfH = getHeight() * 0.5f;
+
+    switch (drag.phase) {
+    case DragInfo::Phase::Start: {
+        const bool inside =
+            (drag.x >= getX() && drag.x <= getX() + getWidth() &&
+                drag.y >= getY() && drag.y <= getY() + getHeight());
+        if (inside) {
+            isDragging = true;
+            setPhysicsEnabled(false); // freeze physics while dragging
         }
+        break;
+    }
+    case DragInfo::Phase::Move: {
+        if (isDragging) {
+            setPosition(drag.x - halfW, drag.y - halfH);
         }
+        break;
+    }
+    case DragInfo::Phase::End: {
+        isDragging = false;
+        setPhysicsEnabled(true); // hand back to physics
+        break;
+    }
     }
 }
 
@@ -110,10 +112,7 @@ void Player::update(float deltaTime) {
         }
     }
 
-    // Tick components (textures, colliders, etc.)
-    Entity::update(deltaTime);
-
-    physicsEnabled = !isDragging;
+    setPhysicsEnabled(!isDragging);
 
     const float jumpForce = jumpSpeed_;
 
@@ -126,49 +125,49 @@ void Player::update(float deltaTime) {
         const int dir = (controls_.right ? 1 : 0) - (controls_.left ? 1 : 0);
         horizVel = static_cast<float>(dir) * moveSpeed_;
     }
-    x += horizVel * deltaTime;
+    moveBy(horizVel * deltaTime, 0.0f);
 
     // --- Grounded check ---
     grounded_ = false;
     float windowHeight = 1080.0f;
 
+    static const ecs::TagId kPlatformTags[] = { TAG_GROUND, TAG_PLATFORM, TAG_MOVING_PLATFORM };
+
     if (auto* myCol = getComponent<BoxCollider>()) {
-        static const char* kTags[] = { "GROUND", "PLATFORM", "MOVING_PLATFORM" };
         auto& mgr = EntityManager::getInstance();
         SDL_FRect myAABB = myCol->aabb();
 
-        // Platform/ground check
-        for (Entity* e : mgr.entities) {
-            if (!e || e == this) continue;
-            bool tagMatch = false;
-            for (auto* t : kTags) { if (e->hasTag(t)) { tagMatch = true; break; } }
-            if (!tagMatch) continue;
-
-            if (auto* otherCol = e->getComponent<BoxCollider>()) {
-                SDL_FRect otherAABB = otherCol->aabb();
-
-                float feetY = myAABB.y + myAABB.h;
-                bool horizontallyAligned =
-                    (myAABB.x + myAABB.w > otherAABB.x) &&
-                    (myAABB.x < otherAABB.x + otherAABB.w);
-                bool feetOnPlatform =
-                    horizontallyAligned &&
-                    std::abs(feetY - otherAABB.y) < 2.0f &&
-                    velY >= 0.0f;
-
-                if (feetOnPlatform) {
-                    grounded_ = true;
-                    y = otherAABB.y - myAABB.h;
-                    break;
-                }
+        // Platform/ground check (only walks tagged entities that have a collider)
+        auto onPlatform = [&](Entity* e) {
+            if (e == this) return false;
+            SDL_FRect otherAABB = e->getComponent<BoxCollider>()->aabb();
+
+            float feetY = myAABB.y + myAABB.h;
+            bool horizontallyAligned =
+                (myAABB.x + myAABB.w > otherAABB.x) &&
+                (myAABB.x < otherAABB.x + otherAABB.w);
+            bool feetOnPlatform =
+                horizontallyAligned &&
+                std::abs(feetY - otherAABB.y) < 2.0f &&
+                getVelY() >= 0.0f;
+
+            if (feetOnPlatform) {
+                setY(otherAABB.y - myAABB.h);
+            }
+            return feetOnPlatform;
+        };
+        for (ecs::TagId t : kPlatformTags) {
+            for (Entity* e : mgr.view<BoxCollider>(t)) {
+                if (onPlatform(e)) { grounded_ = true; break; }
             }
+            if (grounded_) break;
         }
 
         // Window bottom check
         float feetY = myAABB.y + myAABB.h;
-        if (!grounded_ && std::abs(feetY - windowHeight) < 2.0f && velY >= 0.0f) {
+        if (!grounded_ && std::abs(feetY - windowHeight) < 2.0f && getVelY() >= 0.0f) {
             grounded_ = true;
-            y = windowHeight - myAABB.h;
+            setY(windowHeight - myAABB.h);
         }
     }
 
@@ -176,32 +175,27 @@ void Player::update(float deltaTime) {
 
     // --- Jump edge-trigger
     if (controls_.jumpRequest && grounded_) {
-        velY = jumpForce;
+        setVelY(jumpForce);
         controls_.jumpRequest = false;
         grounded_ = false;
     }
 
     // --- Gravity and vertical movement ---
     if (!grounded_) {
-        velY += gravity_ * deltaTime;
+        setVelY(getVelY() + gravity_ * deltaTime);
     }
     else {
-        velY = 0.0f;
+        setVelY(0.0f);
     }
-    y += velY * deltaTime;
+    moveBy(0.0f, getVelY() * deltaTime);
 
     // --- Component-based collision vs. tagged platforms ---
     if (auto* myCol = getComponent<BoxCollider>()) {
-        static const char* kTags[] = { "GROUND", "PLATFORM", "MOVING_PLATFORM" };
         auto& mgr = EntityManager::getInstance();
-        for (Entity* e : mgr.entities) {
-            if (!e || e == this) continue;
-            bool tagMatch = false;
-            for (auto* t : kTags) { if (e->hasTag(t)) { tagMatch = true; break; } }
-            if (!tagMatch) continue;
-
-            if (auto* otherCol = e->getComponent<BoxCollider>()) {
-                myCol->resolveAgainst(*otherCol);
+        for (ecs::TagId t : kPlatformTags) {
+            for (Entity* e : mgr.view<BoxCollider>(t)) {
+                if (e == this) continue;
+                myCol->resolveAgainst(*e->getComponent<BoxCollider>());
             }
         }
     }
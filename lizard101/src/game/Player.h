@@ -6,11 +6,13 @@
 class Player : public Entity {
 public:
     Player(std::string name, float x, float y, int w, int h, EventManager& evt);
+    ~Player() override;
 
     void update(float deltaTime) override;
 
-    // Event callback
-    void onEvent(const Event& e);
+    // Event callbacks
+    void onInput(const InputAction& act);
+    void onDrag(const DragInfo& drag);
 
     // Allow external systems (physics) to set grounded state
     void setGrounded(bool g) { grounded_ = g; }
@@ -53,4 +55,5 @@ private:
 
     EventManager* eventMgr_ = nullptr;
     EventManager::ListenerId inputListenerId_ = 0;
+    EventManager::ListenerId dragListenerId_ = 0;
 };
@@ -13,8 +13,4 @@ public:
         setTag("HAZARD");
     }
     ~Spikes() override = default;
-
-    void update(float dt) override {
-        updateComponents(dt);
-    }
 };
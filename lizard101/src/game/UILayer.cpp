@@ -0,0 +1,97 @@
+#include "UILayer.h"
+#include "game/components/TextureRenderer.h"
+#include "game/components/DebugRenderer.h"
+
+// Color mod applied to hovered textured widgets
+static const SDL_Color kHoverTint{ 255, 235, 160, 255 };
+static const SDL_Color kNoTint{ 255, 255, 255, 255 };
+
+Entity* UILayer::createEntity(WidgetKind kind, const SDL_FRect& rect) {
+    const char* name = "UIButton";
+    const char* tag = "UI_BUTTON";
+    if (kind == WidgetKind::Label) { name = "UILabel"; tag = "UI_LABEL"; }
+    else if (kind == WidgetKind::CardSlot) { name = "UICardSlot"; tag = "UI_CARD_SLOT"; }
+
+    Entity* e = newPooled<Entity>(name, rect.x, rect.y,
+        static_cast<int>(rect.w), static_cast<int>(rect.h));
+    e->setTag(tag);
+    e->renderLayer = RenderLayer::UI;
+    return e;
+}
+
+Entity* UILayer::addWidget(WidgetKind kind, int id, const SDL_FRect& rect,
+    SDL_Renderer* renderer, const std::string& texturePath) {
+    Entity* e = createEntity(kind, rect);
+    e->addComponent<TextureRenderer>(renderer, texturePath);
+    manager_.addEntity(e, pooledDeleter());
+    widgets_.push_back(Widget{ kind, id, rect, e, kNoTint, texturePath });
+    return e;
+}
+
+Entity* UILayer::addWidget(WidgetKind kind, int id, const SDL_FRect& rect, SDL_Color color) {
+    Entity* e = createEntity(kind, rect);
+    e->addComponent<DebugRenderer>(color);
+    manager_.addEntity(e, pooledDeleter());
+    widgets_.push_back(Widget{ kind, id, rect, e, color, std::string() });
+    return e;
+}
+
+int UILayer::hitTest(float x, float y) const {
+    for (const auto& w : widgets_) {
+        if (w.kind == WidgetKind::Label) continue;
+        if (x >= w.rect.x && x <= w.rect.x + w.rect.w &&
+            y >= w.rect.y && y <= w.rect.y + w.rect.h) {
+            return w.id;
+        }
+    }
+    return -1;
+}
+
+void UILayer::applyHighlight(Widget& w, bool on) {
+    if (auto* tr = w.entity->getComponent<TextureRenderer>()) {
+        tr->setColorMod(on ? kHoverTint : kNoTint);
+    }
+    if (auto* dr = w.entity->getComponent<DebugRenderer>()) {
+        SDL_Color c = w.baseColor;
+        if (on) {
+            // lighten toward white
+            c.r = static_cast<Uint8>(c.r + (255 - c.r) / 3);
+            c.g = static_cast<Uint8>(c.g + (255 - c.g) / 3);
+            c.b = static_cast<Uint8>(c.b + (255 - c.b) / 3);
+        }
+        dr->setColor(c);
+    }
+}
+
+void UILayer::setHovered(int id) {
+    if (id == hoveredId_) return; // nothing changed, nothing to touch
+
+    for (auto& w : widgets_) {
+        if (w.kind == WidgetKind::Label) continue;
+        if (w.id == hoveredId_) applyHighlight(w, false);
+        else if (w.id == id) applyHighlight(w, true);
+    }
+    hoveredId_ = id;
+}
+
+void UILayer::setTexture(int id, const std::string& texturePath) {
+    for (auto& w : widgets_) {
+        if (w.id != id || w.texturePath == texturePath) continue;
+        if (auto* tr = w.entity->getComponent<TextureRenderer>()) {
+            tr->setTexture(texturePath);
+            w.texturePath = texturePath;
+        }
+    }
+}
+
+void UILayer::clear() {
+    for (auto& w : widgets_) {
+        manager_.removeEntity(w.entity);
+    }
+    forget();
+}
+
+void UILayer::forget() {
+    widgets_.clear();
+    hoveredId_ = -1;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <SDL3/SDL.h>
+
+#include "Entity.h"
+#include "EntityManager.h"
+
+enum class WidgetKind {
+    Button,     // clickable, usually textured
+    Label,      // display only, never hit-tested
+    CardSlot,   // clickable card art (card reward choices)
+};
+
+// Retained-mode widget layer for menu screens.
+// Widgets are entities created once when a screen is entered; afterwards the controller
+// only hit-tests the cached rects and mutates widgets in place (hover tint, texture swap).
+class UILayer {
+public:
+    explicit UILayer(EntityManager& manager) : manager_(manager) {}
+
+    // Textured widget (button, label or card slot)
+    Entity* addWidget(WidgetKind kind, int id, const SDL_FRect& rect,
+        SDL_Renderer* renderer, const std::string& texturePath);
+
+    // Solid color widget (drawn with DebugRenderer)
+    Entity* addWidget(WidgetKind kind, int id, const SDL_FRect& rect, SDL_Color color);
+
+    // Returns the id of the clickable widget under (x, y), or -1
+    int hitTest(float x, float y) const;
+
+    // Highlight the widget with this id (-1 clears the highlight)
+    void setHovered(int id);
+    int  hovered() const { return hoveredId_; }
+
+    // Swap the texture of every widget with this id
+    void setTexture(int id, const std::string& texturePath);
+
+    // Remove all widget entities from the manager
+    void clear();
+
+    // Drop widget pointers without removing them (after EntityManager::destroyAll)
+    void forget();
+
+    bool empty() const { return widgets_.empty(); }
+
+private:
+    struct Widget {
+        WidgetKind kind;
+        int        id;
+        SDL_FRect  rect;       // cached screen-space hit rect
+        Entity*    entity;
+        SDL_Color  baseColor;  // only used by solid color widgets
+        std::string texturePath;
+    };
+
+    Entity* createEntity(WidgetKind kind, const SDL_FRect& rect);
+    void applyHighlight(Widget& w, bool on);
+
+    EntityManager& manager_;
+    std::vector<Widget> widgets_;
+    int hoveredId_ = -1;
+};
@@ -72,24 +72,19 @@ public:
         if (px < py) {
             // Resolve on X
             float sx = (dx < 0.f) ? -1.f : 1.f;
-            a->x += sx * px;
+            a->moveBy(sx * px, 0.f);
         }
         else {
             // Resolve on Y
             float sy = (dy < 0.f) ? -1.f : 1.f;
-            a->y += sy * py;
-            a->velY = 0.f; // snap ground/ceiling stops vertical motion
+            a->moveBy(0.f, sy * py);
+            a->setVelY(0.f); // snap ground/ceiling stops vertical motion
         }
 
         // Raise a collision event (and print a short line if debug is enabled)
         if (events_) {
             EVENT_LOG(std::string("[raise] Collision ") + a->name + " vs " + b->name);
-            events_->raise(Event{
-                EventType::Collision,
-                EventPriority::High,
-                0.0f,
-                EventPayload{ CollisionInfo{ a, b } }
-                });
+            events_->raise(CollisionInfo{ a, b }, EventPriority::High);
         }
         return true;
     }
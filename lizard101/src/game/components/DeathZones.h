@@ -2,6 +2,7 @@
 #include "ecs/Component.h"
 #include "EntityManager.h"
 #include "Entity.h"
+#include "SpawnPoint.h"
 #include "../Camera.h"
 #include <string>
 #include <cmath>
@@ -12,13 +13,15 @@
 class DeathZone : public ecs::Component {
 
 public:
+	static constexpr ecs::UpdatePhase kUpdatePhase = ecs::UpdatePhase::Collision;
+
 	// If spawnName is empty, the nearest entity with tag "SPAWN" will be used.
 	DeathZone(const std::string& spawnName = "") : spawnName_(spawnName) {}
 
 	void setEventManager(EventManager* ev) { events_ = ev; }
 
 	void onUpdate(float dt) override {
-		Entity* player = EntityManager::getInstance().findEntityByName("Player");
+		Entity* player = EntityManager::getInstance().findCached(player_, "Player");
 		if (!player) return;
 
 		Entity* owner = getOwner();
@@ -41,12 +44,7 @@ public:
 		const bool currentlyInside = collisionDetection(*owner, *player);
 		if (currentlyInside && !playerWasInside_) {
 			// Entered the zone this frame
-			events_->raise(Event{
-				EventType::Death,
-				EventPriority::High,
-				0.0f,
-				EventPayload{ DeathInfo{ player } }
-			});
+			events_->raise(DeathInfo{ player }, EventPriority::High);
 			// Activate cooldown to prevent immediate re-triggering while server processes respawn
 			respawnCooldownActive_ = true;
 			respawnTimer_ = 0.0f;
@@ -69,37 +67,30 @@ public:
 				// Find the nearest spawn point
 				float nearestSpawn = std::numeric_limits<float>::max();
 
-				for (auto* entities : EntityManager::getInstance().entities) {
-					if (!entities) {
-						continue;
-					}
-                    
-					// Check for "SPAWN" tag
-					if (entities->hasTag("SPAWN")) {
-						float dx = (entities->x + entities->width*0.5f) - (player->x + player->width*0.5f);
-						float dy = (entities->y + entities->height*0.5f) - (player->y + player->height*0.5f);
-						float d = std::sqrt(dx*dx + dy*dy);
-						if (d < nearestSpawn) { 
-							nearestSpawn = d; 
-							spawn = entities; 
-						}
+				for (auto* entities : EntityManager::getInstance().view<SpawnPoint>(TAG_SPAWN)) {
+					float dx = (entities->getX() + entities->getWidth()*0.5f) - (player->getX() + player->getWidth()*0.5f);
+					float dy = (entities->getY() + entities->getHeight()*0.5f) - (player->getY() + player->getHeight()*0.5f);
+					float d = std::sqrt(dx*dx + dy*dy);
+					if (d < nearestSpawn) { 
+						nearestSpawn = d; 
+						spawn = entities; 
 					}
 				}
 			}
 
 			// Teleport player to spawn point
 			if (spawn) {
-				player->x = spawn->x;
-				player->y = spawn->y;
-				player->velY = 0.0f;
+				player->setPosition(spawn->getX(), spawn->getY());
+				player->setVelY(0.0f);
 					respawnCooldownActive_ = true;
 					respawnTimer_ = 0.0f;
-				Camera::getInstance().smoothTo(spawn->x - 200.0f, spawn->y - 100.0f, 0.4f);
+				Camera::getInstance().smoothTo(spawn->getX() - 200.0f, spawn->getY() - 100.0f, 0.4f);
 			}
 		}
 
 		std::string spawnName_;
 		EventManager* events_ = nullptr;
+		EntityHandle player_;
 		bool playerWasInside_ = false;
 		bool respawnCooldownActive_ = false;
 		float respawnTimer_ = 0.0f;
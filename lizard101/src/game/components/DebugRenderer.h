@@ -2,6 +2,7 @@
 #include "ecs/Component.h"
 #include <SDL3/SDL.h>
 #include "../Camera.h"
+#include "SpriteBatch.h"
 
 // DebugRenderer: draws a filled rectangle of a given color for testing hidden objects
 class DebugRenderer : public ecs::Component {
@@ -16,8 +17,14 @@ public:
         return enabled_; 
     }
 
-    // Render a filled rectangle over the owner's position
-    void onRender(SDL_Renderer* renderer) override {
+    void setColor(SDL_Color color) { color_ = color; }
+    SDL_Color color() const { return color_; }
+
+    void setLayer(int layer) { layer_ = layer; }
+    int  layer() const { return layer_; }
+
+    // Render a filled rectangle over the owner's position (batched into SDL_RenderFillRects)
+    void onRender(SDL_Renderer* /*renderer*/) override {
     if (!enabled_) return;
     Entity* owner = getOwner();
     if (!owner) 
@@ -25,13 +32,11 @@ public:
 
     SDL_FRect worldDst{ owner->getX(), owner->getY(), static_cast<float>(owner->getWidth()), static_cast<float>(owner->getHeight()) };
     SDL_FRect dstF = Camera::getInstance().worldToScreen(worldDst);
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, color_.r, color_.g, color_.b, color_.a);
-    SDL_RenderFillRect(renderer, &dstF);
-        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SpriteBatch::getInstance().submitRect(dstF, color_, layer_);
     }
 
 private:
     SDL_Color color_;
+    int layer_ = 0;
     static inline bool enabled_ = true;
 };
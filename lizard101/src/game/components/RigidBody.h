@@ -15,7 +15,7 @@ public:
         if (dynamic_) {
             // Make sure the physics system considers this entity.
             if (auto* e = getOwner()) {
-                e->physicsEnabled = true;
+                e->setPhysicsEnabled(true);
             }
         }
     }
@@ -24,7 +24,7 @@ public:
     void setDynamic(bool dyn) {
         dynamic_ = dyn;
         if (auto* e = getOwner()) {
-            e->physicsEnabled = dyn;
+            e->setPhysicsEnabled(dyn);
         }
     }
     bool isDynamic() const { return dynamic_; }
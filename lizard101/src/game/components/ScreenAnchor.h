@@ -6,6 +6,11 @@
 class ScreenAnchor : public ecs::Component {
 
 public:
+    // Runs after everything that moves, right before drawing
+    static constexpr ecs::UpdatePhase kUpdatePhase = ecs::UpdatePhase::Animation;
+    // Reads the camera, writes only its owner's position
+    static constexpr ecs::ThreadAccess kThreadAccess = ecs::ThreadAccess::OwnerOnly;
+
     ScreenAnchor(float screenX = 0.0f, float screenY = 0.0f) : screenX_(screenX), screenY_(screenY) {}
 
     void onUpdate(float dt) override {
@@ -17,8 +22,8 @@ public:
             return;
         }
 
-        owner->x = screenX_ + Camera::getInstance().getX();
-        owner->y = screenY_ + Camera::getInstance().getY();
+        owner->setX(screenX_ + Camera::getInstance().getX());
+        owner->setY(screenY_ + Camera::getInstance().getY());
     }
 
     float getScreenX() const { 
@@ -13,6 +13,8 @@
 class SideScroll : public ecs::Component {
 
 public:
+	static constexpr ecs::UpdatePhase kUpdatePhase = ecs::UpdatePhase::Movement;
+
 
 	SideScroll(float shiftX = 800.0f, float cooldownSeconds = 0.1f, float boundaryMoveAfter = 800.0f, bool moveBoundary = true)
 		: shiftX_(shiftX), cooldown_(cooldownSeconds), boundaryMoveAfter_(boundaryMoveAfter), moveBoundary_(moveBoundary) {}
@@ -21,8 +23,8 @@ public:
 		prevColliding_ = false;
 		timer_ = 0.0f;
         // initialize lastPlayerX_ if player exists
-        if (Entity* p = EntityManager::getInstance().findEntityByName("Player")) {
-            lastPlayerX_ = p->x;
+        if (Entity* p = EntityManager::getInstance().findCached(player_, "Player")) {
+            lastPlayerX_ = p->getX();
         }
 	}
 
@@ -37,14 +39,14 @@ public:
 			}
 
 			// Update lastPlayerX_ to avoid large jumps when re-enabled
-			if (Entity* ptmp = EntityManager::getInstance().findEntityByName("Player")) {
-				lastPlayerX_ = ptmp->x;
+			if (Entity* ptmp = EntityManager::getInstance().findCached(player_, "Player")) {
+				lastPlayerX_ = ptmp->getX();
 			}
 			return;
 		}
 
 		timer_ += dt;
-		Entity* player = EntityManager::getInstance().findEntityByName("Player");
+		Entity* player = EntityManager::getInstance().findCached(player_, "Player");
 		Entity* owner = getOwner();
 		
 		if (!player || !owner) 
@@ -52,7 +54,7 @@ public:
 
 		// Check for player collision with boundary
 		bool coll = collisionDetection(*owner, *player);
-		float dx = player->x - lastPlayerX_;
+		float dx = player->getX() - lastPlayerX_;
 
 		// Minimum movement threshold to consider approaching the boundary
 		const float moveThreshold = 1.0f;
@@ -93,25 +95,25 @@ public:
 						rearmTimer_ = 0.0f;
 						SDL_Log("SideScroll: screen-anchored boundary '%s' triggered; temporarily disabled for %.2fs", owner->name.c_str(), rearmSeconds_);
 					} else {
-						owner->x += (effectiveShift >= 0.0f ? 1.0f : -1.0f) * boundaryMoveAfter_;
-						SDL_Log("SideScroll: moved boundary '%s' by %.1f to x=%.1f", owner->name.c_str(), (effectiveShift >= 0.0f ? 1.0f : -1.0f) * boundaryMoveAfter_, owner->x);
+						owner->setX(owner->getX() + (effectiveShift >= 0.0f ? 1.0f : -1.0f) * boundaryMoveAfter_);
+						SDL_Log("SideScroll: moved boundary '%s' by %.1f to x=%.1f", owner->name.c_str(), (effectiveShift >= 0.0f ? 1.0f : -1.0f) * boundaryMoveAfter_, owner->getX());
 					}
 				}
 
 				// Push player out of the boundary to avoid getting stuck
-				float playerLeft = player->x;
-				float playerRight = player->x + player->width;
-				float boundaryLeft = owner->x;
-				float boundaryRight = owner->x + owner->width;
+				float playerLeft = player->getX();
+				float playerRight = player->getX() + player->getWidth();
+				float boundaryLeft = owner->getX();
+				float boundaryRight = owner->getX() + owner->getWidth();
 
 				// Right boundary
 				if (shiftX_ > 0.0f && playerRight > boundaryLeft) {         
-					player->x = boundaryLeft - player->width - 0.1f;
+					player->setX(boundaryLeft - player->getWidth() - 0.1f);
 				}
 
 				// Left boundary
 				else if (shiftX_ < 0.0f && playerLeft < boundaryRight) { 
-					player->x = boundaryRight + 0.1f;
+					player->setX(boundaryRight + 0.1f);
 				}
 
 			} else {
@@ -122,7 +124,7 @@ public:
 		}
 
 		prevColliding_ = coll;
-		lastPlayerX_ = player->x;
+		lastPlayerX_ = player->getX();
 	}
 
 
@@ -137,5 +139,6 @@ private:
 	bool disabled_ = false;
 	float rearmSeconds_ = 0.5f;
 	float rearmTimer_ = 0.0f;
+	EntityHandle player_;
 };
 
@@ -8,5 +8,4 @@ class SpawnPoint : public ecs::Component {
 public:
     SpawnPoint() {}
     void onStart() override {}
-    void onUpdate(float dt) override {}
 };
@@ -1,13 +1,27 @@
 #pragma once
+#include <memory>
 #include <string>
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include "ecs/Component.h"
+#include "TextureCache.h"
+#include "TextureAtlas.h"
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "SpriteBatch.h"
 #include "../Camera.h"
 
 // Currently TextureRenderer supports static rendering OR sprite-sheet animation.
+// Textures come from the shared TextureCache, so renderers showing the same file share one texture.
+// Images packed into the TextureAtlas are drawn as a sub-rect of their atlas page instead.
+// Source rects and animation frames are always given in the original image's pixels.
+// Drawing goes through the SpriteBatch; layer orders quads within the owner's RenderLayer.
+// When the AssetLoader is running, images outside the atlas load in the background: the previous
+// texture (or the placeholder / red box if there is none) is drawn until the new one is ready.
 class TextureRenderer : public ecs::Component {
 public:
+    static constexpr ecs::UpdatePhase kUpdatePhase = ecs::UpdatePhase::Animation;
+    static constexpr ecs::ThreadAccess kThreadAccess = ecs::ThreadAccess::OwnerOnly; // animation state only
+
     explicit TextureRenderer(SDL_Renderer* renderer, const std::string& filePath)
         : renderer_(renderer) {
         loadFromFile(filePath);
@@ -23,7 +37,25 @@ public:
         setAnimation(frameW, frameH, columns, rows, fps);
     }
 
-    ~TextureRenderer() override { if (texture_) SDL_DestroyTexture(texture_); }
+    ~TextureRenderer() override = default; // handle releases the cached texture
+
+    // Swap to a different image, keeping animation/source-rect settings
+    bool setTexture(const std::string& filePath) {
+        return loadFromFile(filePath);
+    }
+
+    // Drawn instead of the red box while a texture is still loading (empty = red box)
+    static void setPlaceholder(TextureHandle placeholder) { placeholderTexture() = std::move(placeholder); }
+
+    // True while an asynchronous load is still in flight
+    bool loading() const { return pending_ != nullptr; }
+
+    // Per-renderer tint (sent as vertex color, the shared texture itself is untouched)
+    void setColorMod(SDL_Color c) { colorMod_ = c; }
+    SDL_Color colorMod() const { return colorMod_; }
+
+    void setLayer(int layer) { layer_ = layer; }
+    int  layer() const { return layer_; }
 
     void setSourceRect(float x, float y, float w, float h) {
         hasStaticSrc_ = (w > 0 && h > 0);
@@ -32,11 +64,7 @@ public:
 
     void setAnimation(int frameW, int frameH, int columns, int rows, float fps) {
         frameW_ = frameW; frameH_ = frameH; fps_ = fps;
-
-        float tw = 0, th = 0;
-        if (texture_) SDL_GetTextureSize(texture_, &tw, &th);
-        texW_ = static_cast<int>(tw);
-        texH_ = static_cast<int>(th);
+        requestedColumns_ = columns; requestedRows_ = rows;
 
         columns_ = (columns > 0) ? columns : (frameW_ > 0 ? texW_ / frameW_ : 0);
         rows_ = (rows > 0) ? rows : (frameH_ > 0 ? texH_ / frameH_ : 0);
@@ -67,7 +95,7 @@ public:
         }
     }
 
-    void onRender(SDL_Renderer* renderer) override {
+    void onRender(SDL_Renderer* /*renderer*/) override {
         Entity* e = getOwner();
         if (!e) return;
 
@@ -76,10 +104,18 @@ public:
                             static_cast<float>(e->getHeight()) };
         SDL_FRect dst = Camera::getInstance().worldToScreen(worldDst);
 
-        // --- Fallback: draw solid red box if no texture ---
+        if (pending_ && pending_->done()) {
+            finishPending();
+        }
+
+        // --- Fallback: placeholder (or solid red box) if no texture yet ---
         if (!texture_) {
-            SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255);
-            SDL_RenderFillRect(renderer, &dst);
+            if (pending_ && placeholderTexture()) {
+                SpriteBatch::getInstance().submit(placeholderTexture().get(), nullptr, dst, colorMod_, layer_);
+            }
+            else {
+                SpriteBatch::getInstance().submitRect(dst, SDL_Color{ 255, 0, 0, 255 }, layer_);
+            }
             return;
         }
 
@@ -87,41 +123,103 @@ public:
         SDL_FRect local{};
 
         if (animated_) {
-            local.x = static_cast<float>(currentFrame_ * frameW_);
-            local.y = static_cast<float>(currentRow_ * frameH_);
-            local.w = static_cast<float>(frameW_);
-            local.h = static_cast<float>(frameH_);
+            local = toTextureRect(SDL_FRect{
+                static_cast<float>(currentFrame_ * frameW_),
+                static_cast<float>(currentRow_ * frameH_),
+                static_cast<float>(frameW_),
+                static_cast<float>(frameH_) });
             src = &local;
         }
         else if (hasStaticSrc_) {
-            src = &staticSrc_;
+            local = toTextureRect(staticSrc_);
+            src = &local;
+        }
+        else if (inAtlas_) {
+            src = &region_; // whole image = its atlas sub-rect
         }
         else {
             src = nullptr; // whole texture
         }
 
-        SDL_RenderTexture(renderer, texture_, src, &dst);
+        SpriteBatch::getInstance().submit(texture_.get(), src, dst, colorMod_, layer_);
     }
 
 private:
+    // Maps a rect in image pixels to texture pixels (identity unless atlas-backed or pre-scaled)
+    SDL_FRect toTextureRect(const SDL_FRect& r) const {
+        if (!inAtlas_ && regionScale_ == 1.0f) return r;
+        return SDL_FRect{ region_.x + r.x * regionScale_, region_.y + r.y * regionScale_,
+                          r.w * regionScale_, r.h * regionScale_ };
+    }
+
+    static TextureHandle& placeholderTexture() {
+        static TextureHandle placeholder;
+        return placeholder;
+    }
+
     bool loadFromFile(const std::string& filePath) {
-        if (texture_) { SDL_DestroyTexture(texture_); texture_ = nullptr; }
-        texture_ = IMG_LoadTexture(renderer_, filePath.c_str());
+        pending_.reset(); // a newer request wins over one still in flight
+
+        if (const AtlasRegion* region = TextureAtlas::getInstance().find(renderer_, filePath)) {
+            texture_ = region->page;
+            inAtlas_ = true;
+            region_ = region->rect;
+            regionScale_ = region->scale;
+            texW_ = static_cast<int>(region_.w / regionScale_ + 0.5f);
+            texH_ = static_cast<int>(region_.h / regionScale_ + 0.5f);
+            return true;
+        }
+
+        AssetLoader& loader = AssetLoader::getInstance();
+        if (loader.running()) {
+            // Keep showing the current texture until the new one is uploaded
+            pending_ = loader.requestTexture(renderer_, filePath);
+            if (pending_->done()) finishPending();
+            return true;
+        }
+
+        return useTexture(TextureCache::getInstance().acquire(renderer_, filePath), filePath);
+    }
+
+    void finishPending() {
+        std::shared_ptr<PendingTexture> done = std::move(pending_);
+        useTexture(done->texture, done->path);
+    }
+
+    bool useTexture(TextureHandle texture, const std::string& filePath) {
+        inAtlas_ = false;
+        regionScale_ = AssetPack::getInstance().scaleOf(filePath);
+        texture_ = std::move(texture);
         if (!texture_) {
+            if (!TextureCache::getInstance().decodeEnabled()) return false; // headless, expected
             SDL_Log("TextureRenderer: failed to load '%s': %s",
                 filePath.c_str(), SDL_GetError());
             return false;
         }
         float tw = 0, th = 0;
-        SDL_GetTextureSize(texture_, &tw, &th);
-        texW_ = static_cast<int>(tw);
-        texH_ = static_cast<int>(th);
+        SDL_GetTextureSize(texture_.get(), &tw, &th);
+        region_ = SDL_FRect{ 0, 0, tw, th };
+        texW_ = static_cast<int>(tw / regionScale_ + 0.5f);
+        texH_ = static_cast<int>(th / regionScale_ + 0.5f);
+
+        // frame counts derived from the texture size need the real size
+        if (frameW_ > 0 || frameH_ > 0) {
+            setAnimation(frameW_, frameH_, requestedColumns_, requestedRows_, fps_);
+        }
         return true;
     }
 
 private:
     SDL_Renderer* renderer_ = nullptr; // not owned
-    SDL_Texture* texture_ = nullptr; // owned
+    TextureHandle texture_;            // shared via TextureCache (or an atlas page)
+    std::shared_ptr<PendingTexture> pending_; // async load in flight, if any
+
+    bool      inAtlas_ = false;
+    SDL_FRect region_{ 0,0,0,0 };      // image location inside its texture (an atlas page or the whole texture)
+    float     regionScale_ = 1.0f;     // texture pixels per image pixel (< 1 if atlas/pack downscaled it)
+
+    SDL_Color colorMod_{ 255, 255, 255, 255 };
+    int       layer_ = 0;
 
     bool      hasStaticSrc_ = false;
     SDL_FRect staticSrc_{ 0,0,0,0 };
@@ -132,6 +230,8 @@ private:
     int   frameH_ = 0;
     int   columns_ = 0;
     int   rows_ = 0;
+    int   requestedColumns_ = 0;  // as passed to setAnimation (0 = derive from texture size)
+    int   requestedRows_ = 0;
     float fps_ = 0.f;
 
     int   currentRow_ = 0;
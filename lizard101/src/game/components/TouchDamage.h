@@ -7,6 +7,8 @@
 // Rate-limited by cooldownSeconds.
 class TouchDamage : public ecs::Component {
 public:
+    static constexpr ecs::UpdatePhase kUpdatePhase = ecs::UpdatePhase::Collision;
+
     TouchDamage(int damagePerHit = 1, float cooldownSeconds = 1.0f)
         : damagePerHit_(damagePerHit), cooldown_(cooldownSeconds) {
     }
@@ -14,8 +16,8 @@ public:
     void onUpdate(float dt) override {
         timer_ += dt;
 
-        // Find the player once per frame (fine for now, could cache later)
-        Entity* player = EntityManager::getInstance().findEntityByName("Player");
+        // Cached handle, only searched again once the player is gone
+        Entity* player = EntityManager::getInstance().findCached(player_, "Player");
         if (!player) return;
 
         // Owner is the spikes entity
@@ -42,4 +44,5 @@ private:
     int   damagePerHit_;
     float cooldown_;
     float timer_ = 0.0f;
+    EntityHandle player_;
 };
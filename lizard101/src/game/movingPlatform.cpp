@@ -24,13 +24,13 @@ void MovingPlatform::update(float deltaTime) {
     if (!isMoving) return;
 
     if (moveHorizontal) {
-        x += moveSpeed * deltaTime * direction;
-        if (x >= startX + moveRange) { x = startX + moveRange; direction = -1; }
-        else if (x <= startX) { x = startX;             direction = 1; }
+        moveBy(moveSpeed * deltaTime * direction, 0.f);
+        if (getX() >= startX + moveRange) { setX(startX + moveRange); direction = -1; }
+        else if (getX() <= startX) { setX(startX);             direction = 1; }
     }
     else {
-        y += moveSpeed * deltaTime * direction;
-        if (y >= startY + moveRange) { y = startY + moveRange; direction = -1; }
-        else if (y <= startY) { y = startY;             direction = 1; }
+        moveBy(0.f, moveSpeed * deltaTime * direction);
+        if (getY() >= startY + moveRange) { setY(startY + moveRange); direction = -1; }
+        else if (getY() <= startY) { setY(startY);             direction = 1; }
     }
 }
@@ -7,6 +7,8 @@ public:
         bool horizontal, float speed, float range);
 
     void update(float deltaTime) override;
+    // Only moves itself
+    ecs::ThreadAccess updateAccess() const override { return ecs::ThreadAccess::OwnerOnly; }
 
 private:
     bool  isMoving = true;
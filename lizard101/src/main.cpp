@@ -7,12 +7,20 @@
 #include "events/Event.h"
 #include "EntityManager.h"
 #include "game/Lizard101Controller.h"
+#include "TextureAtlas.h"
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "TextureCache.h"
+#include "InputScript.h"
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
 #include <SDL3_image/SDL_image.h>
+#include <algorithm>
 #include <atomic>
 #include <iostream>
+#include <cstring>
+#include <cstdlib>
 
 // Global debug toggle (declared in main.h)
 bool gEventLogEnabled = false;
@@ -20,25 +28,87 @@ bool gEventLogEnabled = false;
 // main.h declares this as extern, we keep the definition here:
 std::atomic<int> pauseRequested{ 0 };
 
-int main(int, char**) {
+int main(int argc, char** argv) {
+    // --bench-frames N: run N frames, report frame time stats, then exit.
+    // Used as a regression benchmark (e.g. idling on the main menu).
+    // --atlas-manifest FILE: write the sprite atlas sub-rect manifest after startup.
+    // --asset-pack FILE: pre-decoded pack built by packassets (default media.pack, if present).
+    // --headless: no window, no texture decode, no rendering; runs the game loop on a software
+    //   renderer with a fixed dt so only simulation/controller cost is measured (default 600 frames).
+    // --fixed-dt SECONDS: fixed timestep (headless defaults to 1/60).
+    // --input-script FILE: scripted mouse/keyboard input, see InputScript.h.
+    // --parallel-update [THREADS]: run thread-safe entity/component updates on worker threads.
+    int benchFrames = 0;
+    const char* atlasManifest = nullptr;
+    const char* assetPack = "media.pack";
+    bool headless = false;
+    float fixedDt = 0.0f;
+    const char* inputScriptPath = nullptr;
+    int parallelThreads = -1; // -1 = serial update
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--bench-frames") == 0 && i + 1 < argc) {
+            benchFrames = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--atlas-manifest") == 0 && i + 1 < argc) {
+            atlasManifest = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--asset-pack") == 0 && i + 1 < argc) {
+            assetPack = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        }
+        else if (std::strcmp(argv[i], "--fixed-dt") == 0 && i + 1 < argc) {
+            fixedDt = static_cast<float>(std::atof(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--input-script") == 0 && i + 1 < argc) {
+            inputScriptPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--parallel-update") == 0) {
+            parallelThreads = 0;
+            if (i + 1 < argc && argv[i + 1][0] != '-') parallelThreads = std::atoi(argv[++i]);
+        }
+    }
+
+    InputScript inputScript;
+    if (inputScriptPath) {
+        if (!inputScript.load(inputScriptPath)) return 1;
+        Input::setScripted(true);
+    }
+    if (headless) {
+        Input::setScripted(true);
+        if (fixedDt <= 0.0f) fixedDt = 1.0f / 60.0f;
+        if (benchFrames <= 0) benchFrames = std::max(600, inputScript.lastFrame() + 1);
+    }
+
     // SDL core init
-    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+    if (SDL_Init(headless ? SDL_INIT_EVENTS : SDL_INIT_VIDEO) < 0) {
         std::cerr << "SDL_Init failed: " << SDL_GetError() << "\n";
         return 1;
     }
 
-    SDL_Window* window = SDL_CreateWindow(
-        "Lizard101",
-        1920, 1080,
-        SDL_WINDOW_RESIZABLE
-    );
-
-    SDL_Renderer* renderer = SDL_CreateRenderer(window, nullptr);
-    if (!window || !renderer) {
+    SDL_Window*   window = nullptr;
+    SDL_Surface*  headlessTarget = nullptr;
+    SDL_Renderer* renderer = nullptr;
+    if (headless) {
+        // Software renderer on an offscreen surface: components get a valid renderer, nothing is shown
+        headlessTarget = SDL_CreateSurface(1920, 1080, SDL_PIXELFORMAT_RGBA32);
+        renderer = headlessTarget ? SDL_CreateSoftwareRenderer(headlessTarget) : nullptr;
+    }
+    else {
+        window = SDL_CreateWindow(
+            "Lizard101",
+            1920, 1080,
+            SDL_WINDOW_RESIZABLE
+        );
+        renderer = SDL_CreateRenderer(window, nullptr);
+    }
+    if ((!headless && !window) || !renderer) {
         std::cerr << "Failed to create SDL window/renderer: "
             << SDL_GetError() << "\n";
         if (renderer) SDL_DestroyRenderer(renderer);
         if (window)   SDL_DestroyWindow(window);
+        if (headlessTarget) SDL_DestroySurface(headlessTarget);
         SDL_Quit();
         return 1;
     }
@@ -48,14 +118,47 @@ int main(int, char**) {
     Timeline        gameTimeline(1.0f);
     EventManager    eventManager(gameTimeline);
     EntityManager& manager = EntityManager::getInstance();
+    if (fixedDt > 0.0f) {
+        gameTimeline.setFixedStep(fixedDt);
+    }
+    if (parallelThreads >= 0) {
+        manager.setParallelUpdate(true, static_cast<unsigned>(parallelThreads));
+    }
+
+    AssetLoader& assetLoader = AssetLoader::getInstance();
+    const double uploadBudgetMs = 2.0;
+    if (headless) {
+        // Nothing is drawn, so don't pay for decoding (TextureRenderers keep their red-box fallback)
+        TextureCache::getInstance().setDecodeEnabled(false);
+    }
+    else {
+        // Without a pack every image falls back to decoding through SDL_image
+        AssetPack::getInstance().open(assetPack);
+
+        // Decode images off the main thread; uploads are drained below with a per-frame budget
+        assetLoader.start();
+    }
 
     // High-level game controller (menus + deck select + combat)
     Lizard101Controller controller(renderer, physics, gameTimeline, eventManager, manager);
+    if (atlasManifest) {
+        TextureAtlas::getInstance().writeManifest(atlasManifest);
+    }
 
     bool      running = true;
     SDL_Event ev{};
 
+    // Frame time stats for --bench-frames
+    const double perfFreq = static_cast<double>(SDL_GetPerformanceFrequency());
+    int    framesRun = 0;
+    double frameMsTotal = 0.0;
+    double frameMsMin = 1e9;
+    double frameMsMax = 0.0;
+    int    frameIndex = 0;
+
     while (running) {
+        const Uint64 frameStart = SDL_GetPerformanceCounter();
+
         // Basic SDL event handling TODO:|WE WILL NEED TO CHANGE THIS!!! (actually technically we don't but we really should)|
         while (SDL_PollEvent(&ev)) {
             if (ev.type == SDL_EVENT_QUIT) {
@@ -63,28 +166,66 @@ int main(int, char**) {
             }
         }
 
-        // Keyboard / mouse
+        // Keyboard / mouse (scripted input is applied first so update() picks it up)
+        inputScript.apply(frameIndex++);
         Input::update();
 
         // Timeline / delta
         gameTimeline.update();
         float dt = gameTimeline.getDeltaTime();
 
-        // Background
-        SDL_SetRenderDrawColor(renderer, 0, 0, 32, 255);
-        SDL_RenderClear(renderer);
+        // Finish async texture loads before anything draws this frame
+        assetLoader.pump(uploadBudgetMs);
 
-        // Let controller drive the game
-        controller.update(dt);
-        controller.render();
+        if (headless) {
+            controller.update(dt);
+        }
+        else {
+            // Background
+            SDL_SetRenderDrawColor(renderer, 0, 0, 32, 255);
+            SDL_RenderClear(renderer);
+
+            // Let controller drive the game
+            controller.update(dt);
+            controller.render();
+
+            SDL_RenderPresent(renderer);
+        }
 
-        SDL_RenderPresent(renderer);
+        if (benchFrames > 0) {
+            const double ms = (SDL_GetPerformanceCounter() - frameStart) * 1000.0 / perfFreq;
+            frameMsTotal += ms;
+            if (ms < frameMsMin) frameMsMin = ms;
+            if (ms > frameMsMax) frameMsMax = ms;
+            if (++framesRun >= benchFrames) {
+                SDL_Log("Bench: %d frames, avg %.3f ms, min %.3f ms, max %.3f ms",
+                    framesRun, frameMsTotal / framesRun, frameMsMin, frameMsMax);
+                if (headless) {
+                    SDL_Log("Bench: headless, %zu entities alive", manager.entities.size());
+                }
+                else {
+                    SDL_Log("Bench: last frame drew %zu entities, culled %zu",
+                        manager.renderStats().drawn, manager.renderStats().culled);
+                }
+                for (const auto& pass : ecs::SystemRegistry::getInstance().stats()) {
+                    SDL_Log("Bench: pass %s (phase %d%s): %zu components, %.3f ms",
+                        pass.name, static_cast<int>(pass.phase), pass.parallel ? ", parallel" : "",
+                        pass.count, pass.ms);
+                }
+                running = false;
+            }
+        }
     }
 
     // Cleanup
     manager.destroyAll();
+    manager.setParallelUpdate(false);
+    assetLoader.stop();
+    TextureAtlas::getInstance().clear();
+    AssetPack::getInstance().close();
     SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
+    if (window) SDL_DestroyWindow(window);
+    if (headlessTarget) SDL_DestroySurface(headlessTarget);
     SDL_Quit();
     return 0;
 }
@@ -0,0 +1,42 @@
+// Build step: converts the media/ tree into a pre-decoded asset pack (see AssetPack.h).
+//
+//   packassets <mediaDir> <outFile> [--max-size N] [--prefix P]
+//
+// Keys default to "<name of mediaDir>/<relative path>", e.g. "media/cards/fireball.png",
+// which matches the paths the game loads.
+
+#include "AssetPack.h"
+
+#include <SDL3/SDL.h>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: packassets <mediaDir> <outFile> [--max-size N] [--prefix P]\n";
+        return 1;
+    }
+
+    const std::string mediaDir = argv[1];
+    const std::string outFile = argv[2];
+    std::string prefix = std::filesystem::path(mediaDir).lexically_normal().filename().generic_string();
+    if (prefix.empty()) prefix = std::filesystem::path(mediaDir).lexically_normal().parent_path().filename().generic_string();
+    int maxSize = 0;
+
+    for (int i = 3; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) {
+            maxSize = std::atoi(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--prefix") == 0 && i + 1 < argc) {
+            prefix = argv[++i];
+        }
+    }
+
+    const int count = AssetPack::build(mediaDir, prefix, outFile, maxSize);
+    if (count < 0) return 1;
+
+    std::cout << "packassets: wrote " << count << " images to " << outFile << "\n";
+    return 0;
+}
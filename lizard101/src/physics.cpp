@@ -5,29 +5,47 @@ EntityManager& manager = EntityManager::getInstance();
 
 PhysicsSystem::PhysicsSystem(float gravity) : gravity(gravity) { }
 
-void PhysicsSystem::updatePhysics(EntityManager& manager, float deltaTime) {
-	for (auto* e : manager.entities) {
-		if (e->physicsEnabled) {
-			applyGravity(*e, deltaTime);
+void PhysicsSystem::updatePhysics(float deltaTime) {
+	// Same math as applyGravity, streamed over the BodyStore columns instead of per entity
+	BodyStore& b = BodyStore::getInstance();
+	float* y = b.y.data();
+	float* velY = b.velY.data();
+	const int* height = b.height.data();
+	const uint8_t* physics = b.physics.data();
+	const uint8_t* managed = b.managed.data();
+	const size_t n = b.size();
+	const float dv = gravity * deltaTime;
+
+	for (size_t i = 0; i < n; ++i) {
+		if (!(physics[i] & managed[i])) continue;
+		const float oldY = y[i];
+		velY[i] += dv;
+		y[i] += velY[i] * deltaTime;
+
+		const float ground = 1080.0f - height[i];
+		if (y[i] >= ground) {
+			y[i] = ground;   // Reset position to ground level
+			velY[i] = 0.0f;  // Reset vertical velocity
 		}
+		if (y[i] != oldY) b.moved(static_cast<uint32_t>(i)); // resting bodies stay binned
 	}
 }
 
 void PhysicsSystem::applyGravity(Entity& e, float deltaTime) {
-	e.velY += gravity * deltaTime;
+	e.setVelY(e.getVelY() + gravity * deltaTime);
 
-	e.y += e.velY * deltaTime;
+	e.setY(e.getY() + e.getVelY() * deltaTime);
 
 	if (checkCollision(e)) {
-		e.y = 1080.0f - e.height; // Reset position to ground level
-		e.velY = 0.0f; // Reset vertical velocity
+		e.setY(1080.0f - e.getHeight()); // Reset position to ground level
+		e.setVelY(0.0f); // Reset vertical velocity
 	}
 
 }
 
 bool PhysicsSystem::checkCollision(const Entity& e) {
 	
-	return (e.y + e.height) >= 1080.0f; // Temporarily set ground level at y = 1080 (bottom of the window)
+	return (e.getY() + e.getHeight()) >= 1080.0f; // Temporarily set ground level at y = 1080 (bottom of the window)
 }
 
 void PhysicsSystem::setGravity(float g) {
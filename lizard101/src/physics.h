@@ -7,7 +7,8 @@ class PhysicsSystem {
 public:
 
     PhysicsSystem(float gravity = 980.0f);
-    void updatePhysics(EntityManager& manager, float deltaTime);
+    // Steps every physics-enabled body whose entity is in the EntityManager (BodyStore columns)
+    void updatePhysics(float deltaTime);
     void applyGravity(Entity& e, float deltaTime);
     bool checkCollision(const Entity& e);
     void setGravity(float g);
@@ -75,8 +75,8 @@ void client_handler(int clientId, int port, std::string playerName) {
                 std::lock_guard<std::mutex> lock(entityMutex);
                 Entity* e = EntityManager::getInstance().findEntityByName(name);
                 if (e) {
-                    e->x = x;
-                    e->y = y;
+                    e->setX(x);
+                    e->setY(y);
                 }
                 else {
                     auto* player = new Entity(name, x, y, 128, 128, true, false, "PLAYER");
@@ -110,24 +110,19 @@ void client_handler(int clientId, int port, std::string playerName) {
 
                       float moveSpeed = 300.0f; 
                       if (kind == InputAction::Kind::MoveLeft && pressed) {
-                          playerEntity->x -= moveSpeed * gameTimeline.getDeltaTime();
+                          playerEntity->setX(playerEntity->getX() - moveSpeed * gameTimeline.getDeltaTime());
                       }
                       else if (kind == InputAction::Kind::MoveRight && pressed) {
-                          playerEntity->x += moveSpeed * gameTimeline.getDeltaTime();
+                          playerEntity->setX(playerEntity->getX() + moveSpeed * gameTimeline.getDeltaTime());
                       }
                       else if (kind == InputAction::Kind::Jump && pressed) {
                           if (playerEntity->type == "PLAYER") {
-                              playerEntity->y -= 150.0f; 
+                              playerEntity->setY(playerEntity->getY() - 150.0f); 
                           }
                       }
                   }
 
-                  eventManager.raise(Event{
-                      EventType::Input,
-                      EventPriority::High,
-                      0.0f,
-                      EventPayload{ InputAction{ kind, pressed } }
-                      });
+                  eventManager.raise(InputAction{ kind, pressed }, EventPriority::High);
                   reply_str = "EVENT_OK";
               }
           }
@@ -148,18 +143,16 @@ void client_handler(int clientId, int port, std::string playerName) {
                   // Find nearest spawn point
                   Entity* spawn = nullptr;
                   float nearest = std::numeric_limits<float>::max();
-                  for (auto* e : EntityManager::getInstance().entities) {
-                      if (e && e->hasTag("SPAWN")) {
-                          float dx = (e->x + e->width * 0.5f) - (victim->x + victim->width * 0.5f);
-                          float dy = (e->y + e->height * 0.5f) - (victim->y + victim->height * 0.5f);
-                          float d = std::sqrt(dx * dx + dy * dy);
-                          if (d < nearest) { nearest = d; spawn = e; }
-                      }
+                  for (auto* e : EntityManager::getInstance().withTag(TAG_SPAWN)) {
+                      float dx = (e->getX() + e->getWidth() * 0.5f) - (victim->getX() + victim->getWidth() * 0.5f);
+                      float dy = (e->getY() + e->getHeight() * 0.5f) - (victim->getY() + victim->getHeight() * 0.5f);
+                      float d = std::sqrt(dx * dx + dy * dy);
+                      if (d < nearest) { nearest = d; spawn = e; }
                   }
                   if (spawn) {
-                      victim->x = spawn->x;
-                      victim->y = spawn->y;
-                      victim->velY = 0.0f;
+                      victim->setX(spawn->getX());
+                      victim->setY(spawn->getY());
+                      victim->setVelY(0.0f);
                       std::cout << "[Server] Player " << victimName << " respawned at " << spawn->name << std::endl;
                       reply_str = "EVENT_OK";
                   }
@@ -254,8 +247,8 @@ void pub_handler() {
             std::lock_guard<std::mutex> lock(entityMutex);
             for (auto* e : EntityManager::getInstance().entities) {
                 std::string t = e->type.empty() ? "GENERIC" : e->type;
-                state += "|" + e->name + "|" + t + "|" + std::to_string(e->x) + "|" + std::to_string(e->y) +
-                    "|" + std::to_string(e->width) + "|" + std::to_string(e->height);
+                state += "|" + e->name + "|" + t + "|" + std::to_string(e->getX()) + "|" + std::to_string(e->getY()) +
+                    "|" + std::to_string(e->getWidth()) + "|" + std::to_string(e->getHeight());
             }
         }
         state += "|PAUSED|" + std::string(gameTimeline.isPaused() ? "1" : "0");
@@ -272,8 +265,13 @@ void update_handler() {
     while (running) {
         gameTimeline.update();
         float deltaTime = gameTimeline.getDeltaTime();
-        eventManager.dispatch();
-        EntityManager::getInstance().updateAll(deltaTime);
+        {
+            // Client handlers create and move entities under this lock; creating one can grow
+            // the BodyStore columns that the update passes read and write
+            std::lock_guard<std::mutex> lock(entityMutex);
+            eventManager.dispatch();
+            EntityManager::getInstance().updateAll(deltaTime);
+        }
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 }
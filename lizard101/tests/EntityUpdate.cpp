@@ -0,0 +1,88 @@
+// EntityManager::updateAll must visit every live entity exactly once per frame, even when
+// updates remove entities (their own or others) from the swap-removed dense array.
+#include "EntityManager.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static int gFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++gFailures; \
+        } \
+    } while (0)
+
+// Counts its updates; removes itself or a victim on its first one if told to
+struct Counter : Entity {
+    Counter(std::string name, std::vector<int>& counts, int index)
+        : Entity(std::move(name), 0, 0, 1, 1), counts_(counts), index_(index) {}
+
+    void update(float) override {
+        ++counts_[index_];
+        if (victim) {
+            EntityManager::getInstance().removeEntity(victim);
+            victim = nullptr;
+        }
+    }
+
+    Entity* victim = nullptr;
+
+private:
+    std::vector<int>& counts_;
+    int index_;
+};
+
+// An entity removing itself must not make the manager skip the one swapped into its slot
+static void testSelfRemoval() {
+    EntityManager& manager = EntityManager::getInstance();
+    std::vector<int> counts(3, 0);
+    std::vector<Counter*> all;
+    for (int i = 0; i < 3; ++i) {
+        all.push_back(new Counter("c" + std::to_string(i), counts, i));
+        manager.addEntity(all.back());
+    }
+    all[0]->victim = all[0];
+
+    manager.updateAll(0.0f);
+    CHECK(counts[0] == 1 && counts[1] == 1 && counts[2] == 1);
+    CHECK(manager.entities.size() == 2);
+    CHECK(!manager.findEntityByName("c0"));
+
+    manager.updateAll(0.0f);
+    CHECK(counts[1] == 2 && counts[2] == 2);
+    manager.destroyAll();
+}
+
+// Removing one not yet visited still lets it finish the frame; removal lands at the end
+static void testRemovingAnother() {
+    EntityManager& manager = EntityManager::getInstance();
+    std::vector<int> counts(4, 0);
+    std::vector<Counter*> all;
+    for (int i = 0; i < 4; ++i) {
+        all.push_back(new Counter("r" + std::to_string(i), counts, i));
+        manager.addEntity(all.back());
+    }
+    all[1]->victim = all[3];
+    all[2]->victim = all[0];
+
+    manager.updateAll(0.0f);
+    for (int n : counts) CHECK(n == 1);
+    CHECK(manager.entities.size() == 2);
+    CHECK(manager.findEntityByName("r1") && manager.findEntityByName("r2"));
+    manager.destroyAll();
+}
+
+int main() {
+    testSelfRemoval();
+    testRemovingAnother();
+
+    if (gFailures) {
+        std::fprintf(stderr, "entity_update: %d check(s) failed\n", gFailures);
+        return 1;
+    }
+    std::printf("entity_update: ok\n");
+    return 0;
+}
@@ -0,0 +1,197 @@
+// Stress test for the event pipeline: MpscQueue inboxes, FrameArena swapping, coalescing and
+// listener changes during dispatch. Build the event_stress target; for the concurrency
+// checks to mean much, also run it under -fsanitize=thread and -fsanitize=address.
+#include "events/EventManager.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+// Counts every global allocation so steady-state frames can be checked for zero
+static std::atomic<long> gAllocations{ 0 };
+
+// GCC flags free() in a replaced operator delete as mismatched once the std containers inline it
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+static int gFailures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            ++gFailures; \
+        } \
+    } while (0)
+
+// DeathInfo::victim is only compared, never dereferenced, so it can carry (producer, index)
+static Entity* encode(std::uintptr_t producer, std::uintptr_t index) {
+    return reinterpret_cast<Entity*>((producer << 32) | (index << 4) | 0x8);
+}
+static void decode(const Entity* e, std::uintptr_t& producer, std::uintptr_t& index) {
+    const auto v = reinterpret_cast<std::uintptr_t>(e);
+    producer = v >> 32;
+    index = (v & 0xFFFFFFFFu) >> 4;
+}
+
+// Several threads raise while the owner dispatches: everything arrives, FIFO per producer
+static void testManyProducers() {
+    Timeline timeline;
+    EventManager events(timeline);
+
+    constexpr int kProducers = 4;
+    constexpr std::uintptr_t kPerProducer = 100000;
+    std::vector<std::uintptr_t> next(kProducers, 0);
+    long delivered = 0;
+    bool ordered = true;
+    events.subscribe<DeathInfo>([&](const DeathInfo& d) {
+        std::uintptr_t producer = 0, index = 0;
+        decode(d.victim, producer, index);
+        if (producer >= kProducers || index != next[producer]) ordered = false;
+        else ++next[producer];
+        ++delivered;
+        });
+
+    std::vector<std::thread> producers;
+    for (std::uintptr_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&events, p] {
+            for (std::uintptr_t i = 0; i < kPerProducer; ++i) events.raise(DeathInfo{ encode(p, i) });
+            });
+    }
+    while (delivered < kProducers * static_cast<long>(kPerProducer)) events.dispatch();
+    for (auto& t : producers) t.join();
+    events.dispatch();
+
+    CHECK(delivered == kProducers * static_cast<long>(kPerProducer));
+    CHECK(ordered);
+}
+
+// Once warm, raising (on and off the owning thread) and dispatching never allocate;
+// more than an arena's worth in one frame falls back to the heap and still arrives
+static void testNoSteadyStateAllocations() {
+    Timeline timeline;
+    EventManager events(timeline);
+
+    long inputs = 0, deaths = 0;
+    events.subscribe<InputAction>([&](const InputAction&) { ++inputs; });
+    events.subscribe<DeathInfo>([&](const DeathInfo&) { ++deaths; });
+
+    // One long-lived producer, handed work per frame without allocating
+    std::atomic<int> request{ 0 };
+    std::atomic<bool> quit{ false };
+    std::thread producer([&] {
+        while (!quit.load()) {
+            const int n = request.exchange(0);
+            for (int i = 0; i < n; ++i) events.raise(DeathInfo{ nullptr });
+            if (n) request.store(-1); // done
+            else std::this_thread::yield();
+        }
+        });
+    auto frame = [&](int offThread) {
+        request.store(offThread);
+        for (int i = 0; i < 500; ++i) events.raise(InputAction{ InputAction::Kind::Jump, true });
+        while (request.load() != -1) std::this_thread::yield();
+        request.store(0);
+        events.dispatch();
+    };
+
+    for (int i = 0; i < 8; ++i) frame(500);
+    const long before = gAllocations.load();
+    for (int i = 0; i < 50; ++i) frame(500);
+    CHECK(gAllocations.load() == before);
+
+    frame(20000); // overflows the arena
+    CHECK(inputs == 59 * 500);
+    CHECK(deaths == 58 * 500 + 20000);
+
+    quit.store(true);
+    producer.join();
+}
+
+// Drag moves keep only the latest position; Start/End are barriers. Collisions are
+// delivered once per exact (a, b) pair per frame.
+static void testCoalescing() {
+    Timeline timeline;
+    EventManager events(timeline);
+
+    std::vector<DragInfo> drags;
+    events.subscribe<DragInfo>([&](const DragInfo& d) { drags.push_back(d); });
+    long collisions = 0;
+    events.subscribe<CollisionInfo>([&](const CollisionInfo&) { ++collisions; });
+
+    events.raise(DragInfo{ DragInfo::Phase::Start, 0, 0 });
+    for (int i = 1; i <= 100; ++i) events.raise(DragInfo{ DragInfo::Phase::Move, float(i), 0 });
+    events.raise(DragInfo{ DragInfo::Phase::End, 0, 0 });
+    events.raise(DragInfo{ DragInfo::Phase::Move, 7, 0 });
+
+    constexpr std::uintptr_t kPairs = 2000;
+    for (int repeat = 0; repeat < 3; ++repeat) {
+        for (std::uintptr_t i = 1; i <= kPairs; ++i) {
+            events.raise(CollisionInfo{ reinterpret_cast<Entity*>(i * 16), reinterpret_cast<Entity*>(i * 32) });
+            events.raise(CollisionInfo{ reinterpret_cast<Entity*>(i * 32), reinterpret_cast<Entity*>(i * 16) });
+        }
+    }
+    events.dispatch();
+
+    CHECK(drags.size() == 4);
+    if (drags.size() == 4) {
+        CHECK(drags[0].phase == DragInfo::Phase::Start);
+        CHECK(drags[1].phase == DragInfo::Phase::Move && drags[1].x == 100.0f);
+        CHECK(drags[2].phase == DragInfo::Phase::End);
+        CHECK(drags[3].phase == DragInfo::Phase::Move && drags[3].x == 7.0f);
+    }
+    CHECK(collisions == 2 * static_cast<long>(kPairs));
+
+    // A new frame delivers the same pair again
+    events.raise(CollisionInfo{ reinterpret_cast<Entity*>(16), reinterpret_cast<Entity*>(32) });
+    events.dispatch();
+    CHECK(collisions == 2 * static_cast<long>(kPairs) + 1);
+}
+
+// Listener changes made while delivering take effect from the next event
+static void testListenerChangesDuringDispatch() {
+    Timeline timeline;
+    EventManager events(timeline);
+
+    int once = 0, steady = 0, late = 0;
+    EventManager::ListenerId onceId = 0;
+    onceId = events.subscribe<InputAction>([&](const InputAction&) {
+        ++once;
+        events.unsubscribe<InputAction>(onceId);
+        events.subscribe<InputAction>([&](const InputAction&) { ++late; });
+        });
+    events.subscribe<InputAction>([&](const InputAction&) { ++steady; });
+
+    for (int i = 0; i < 3; ++i) events.raise(InputAction{ InputAction::Kind::Jump, true });
+    events.dispatch();
+
+    CHECK(once == 1);
+    CHECK(steady == 3);
+    CHECK(late == 2);
+}
+
+int main() {
+    testManyProducers();
+    testNoSteadyStateAllocations();
+    testCoalescing();
+    testListenerChangesDuringDispatch();
+
+    if (gFailures) {
+        std::fprintf(stderr, "event_stress: %d check(s) failed\n", gFailures);
+        return 1;
+    }
+    std::printf("event_stress: ok\n");
+    return 0;
+}